@@ -0,0 +1,148 @@
+/**
+ * @file main.cpp
+ * @brief Main entry point of aeriencli, the headless front end for batch airport operations.
+ *
+ * @author Chih Taki-eddine
+ * @date 18 October 2026
+ */
+#include "BatchSession.h"
+#include "metrics.h"
+#include "trace.h"
+#include "validationFormat.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+
+namespace
+{
+  const char USAGE[] =
+      "usage: aeriencli [--stats] [--code CODE] [FILE...]\n"
+      "\n"
+      "Runs the airport commands of each FILE, one per line, or of the standard\n"
+      "input without FILE or for \"-\", and stops at the first command that fails.\n"
+      "\n"
+      "  --stats      print the time of each command and the memory used, on stderr\n"
+      "  --code CODE  code of the airport (YUL by default)\n"
+      "\n"
+      "Commands:\n";
+
+  /**
+   * @brief Prints the time, the operation metrics and the memory of a finished run on stderr.
+   */
+  void printStats (const aerien::BatchSession& p_session, std::chrono::steady_clock::duration p_elapsed)
+  {
+    std::cerr << "\n" << p_session.statsReport ();
+    std::cerr << "\noperations of the library\n" << util::metricsReport ();
+    struct rusage usage;
+    getrusage (RUSAGE_SELF, &usage);
+    std::fprintf (stderr, "\nwall time %.3f ms, cpu time %.3f ms, peak resident %ld KiB\n",
+                  std::chrono::duration<double, std::milli> (p_elapsed).count (),
+                  usage.ru_utime.tv_sec * 1e3 + usage.ru_utime.tv_usec / 1e3
+                  + usage.ru_stime.tv_sec * 1e3 + usage.ru_stime.tv_usec / 1e3,
+                  usage.ru_maxrss);
+  }
+}
+
+/**
+ * @brief Main function of aeriencli.
+ *
+ * When the AERIEN_TRACE environment variable names a file, the library
+ * spans are recorded and written to it, as Chrome trace-event JSON.
+ *
+ * @param argc Number of command-line arguments.
+ * @param argv Array of command-line arguments.
+ * @return 0 if every command succeeded, 1 if a command failed, 2 for a usage error.
+ */
+int main (int argc, char *argv[])
+{
+  bool stats = false;
+  std::string code = "YUL";
+  std::vector<std::string> files;
+  for (int i = 1; i < argc; ++i)
+    {
+      if (std::strcmp (argv[i], "--stats") == 0)
+        {
+          stats = true;
+        }
+      else if (std::strcmp (argv[i], "--code") == 0 && i + 1 < argc)
+        {
+          code = argv[++i];
+        }
+      else if (std::strcmp (argv[i], "--help") == 0)
+        {
+          std::cout << USAGE << aerien::BatchSession::usage ();
+          return 0;
+        }
+      else if (argv[i][0] == '-' && argv[i][1] != '\0')
+        {
+          std::cerr << USAGE << aerien::BatchSession::usage ();
+          return 2;
+        }
+      else
+        {
+          files.push_back (argv[i]);
+        }
+    }
+  if (!util::isValideCode (code))
+    {
+      std::cerr << "aeriencli: invalid airport code \"" << code << "\"\n";
+      return 2;
+    }
+  if (files.empty ())
+    {
+      files.push_back ("-");
+    }
+
+  const char* tracePath = std::getenv ("AERIEN_TRACE");
+  util::setTracingEnabled (tracePath != nullptr);
+  util::setMetricsEnabled (stats);
+
+  std::ios::sync_with_stdio (false);
+  auto start = std::chrono::steady_clock::now ();
+  aerien::BatchSession session (std::cout, code);
+  int status = 0;
+  for (const std::string& file : files)
+    {
+      try
+        {
+          if (file == "-")
+            {
+              session.run (std::cin);
+            }
+          else
+            {
+              std::ifstream commands (file);
+              if (!commands)
+                {
+                  throw aerien::BatchError ("cannot open " + file);
+                }
+              session.run (commands);
+            }
+        }
+      catch (aerien::BatchError& e)
+        {
+          std::cout.flush ();
+          std::cerr << "aeriencli: " << (file == "-" ? "stdin" : file) << ": " << e.what () << "\n";
+          status = 1;
+          break;
+        }
+    }
+  std::cout.flush ();
+
+  if (stats)
+    {
+      printStats (session, std::chrono::steady_clock::now () - start);
+    }
+  if (tracePath != nullptr)
+    {
+      std::ofstream trace (tracePath);
+      util::writeTrace (trace);
+    }
+  return status;
+}
@@ -12,7 +12,12 @@
 #include "AddDeparture.h"
 #include "DeleteFlight.h"
 #include "validationFormat.h"
+#include "trace.h"
+#include <QFileDialog>
+#include <QHeaderView>
 #include <QMessageBox>
+#include <chrono>
+#include <random>
 
 using namespace aerien;
 
@@ -20,9 +25,12 @@ using namespace aerien;
  * \brief Constructor for the Airport_Table class.
  * 
  * Initializes the user interface defined in `ui_Airport_Table.h` and
- * initializes the airport and flight data.
+ * initializes the airport and flight data. The rows have a fixed height and
+ * the columns are not sized to their contents, so the view never has to
+ * measure every flight.
  */
-Airport_Table::Airport_Table () : m_air("YUL")
+Airport_Table::Airport_Table () : m_air("YUL"), m_model(m_air), m_filter(m_model), m_loadWorker(nullptr), m_loadProgress(nullptr),
+    m_liveUpdates(LIVE_QUEUE_CAPACITY), m_liveStop(false)
 {
    /* m_aero.ajouterVol(Arrivee("LH0472","LUFTHANSA","22:05","MUNICH"," Retardé "));
     m_aero.ajouterVol(Depart("AC1636","AIR CANADA","18:00","ORLONDO","17:15","C86"));
@@ -40,9 +48,38 @@ Airport_Table::Airport_Table () : m_air("YUL")
 
    */
     widget.setupUi (this);
-    
-    // Initial display of airport information in the interface
-    widget.textEditAir->setPlainText (m_air.getAirportFormatted ().c_str());
+    widget.tableViewAir->setModel (&m_filter);
+    widget.tableViewAir->verticalHeader ()->setSectionResizeMode (QHeaderView::Fixed);
+    widget.tableViewAir->horizontalHeader ()->setStretchLastSection (true);
+
+    m_searchTimer.setSingleShot (true);
+    m_searchTimer.setInterval (SEARCH_DELAY_MS);
+    connect (widget.lineEditSearch, &QLineEdit::textChanged, &m_searchTimer, [this] { m_searchTimer.start (); });
+    connect (&m_searchTimer, &QTimer::timeout, this, &Airport_Table::slotSearch);
+
+    qRegisterMetaType<std::shared_ptr<aerien::Airport>> ();
+    qRegisterMetaType<aerien::LoadReport> ();
+    m_loadThread.setObjectName ("LoadThread");
+    m_loadThread.start ();
+
+    m_liveBatch.reserve (LIVE_QUEUE_CAPACITY);
+    m_liveTimer.setInterval (LIVE_FRAME_MS);
+    connect (&m_liveTimer, &QTimer::timeout, this, &Airport_Table::slotApplyLiveUpdates);
+}
+
+/**
+ * \brief Destructor: cancels a running load and stops the loading thread.
+ */
+Airport_Table::~Airport_Table ()
+{
+    stopLiveSource ();
+    if (m_loadWorker != nullptr)
+    {
+        m_loadWorker->cancel ();
+    }
+    m_loadThread.quit ();
+    m_loadThread.wait ();
+    delete m_loadWorker;
 }
 
 /**
@@ -50,27 +87,26 @@ Airport_Table::Airport_Table () : m_air("YUL")
  * 
  * Opens the AddDeparture dialog, retrieves the input data, and adds
  * a departure flight to the airport. Displays an error message if the
- * flight already exists.
+ * airport refuses the flight.
  */
 void Airport_Table::slotDeparture()
 {
     AddDeparture dGUI;
     if (dGUI.exec())
     {
+        TRACE_SPAN("Airport_Table::slotDeparture");
         try
         {
             Depart unDepart(dGUI.getNumber(), dGUI.getCompany(), dGUI.getHour(), dGUI.getCity(),
                             dGUI.getBoardingHour (), dGUI.getBoardingGate ());
-            m_air.addFlight(unDepart);
-
+            m_model.addFlight(unDepart);
+            widget.tableViewAir->scrollToBottom ();
         }
-        catch (FlightAlreadyExistsException &e)
+        catch (FlightException &e)
         {
             QString message = (e.what());
             QMessageBox::information(this, "ERREUR", message);
         }
-
-        widget.textEditAir->setPlainText(m_air.getAirportFormatted ().c_str());
     }
 }
 
@@ -80,23 +116,24 @@ void Airport_Table::slotDeparture()
  * 
  * Opens the AddArrival dialog, retrieves the input data, and adds
  * an arrival flight to the airport. Displays an error message if the
- * flight already exists.
+ * airport refuses the flight.
  */
 void Airport_Table::slotArrival(){
   AddArrival aGUI;
   if (aGUI.exec()){
+      TRACE_SPAN("Airport_Table::slotArrival");
       try
         {
           aerien::Arrival unArrivee(aGUI.getNumber (), aGUI.getCompany (),
                                     aGUI.getHour (), aGUI.getCity (), aGUI.getStatus());
           
-          m_air.addFlight(unArrivee);
-        }catch(FlightAlreadyExistsException &e)
+          m_model.addFlight(unArrivee);
+          widget.tableViewAir->scrollToBottom ();
+        }catch(FlightException &e)
           {
             QString message = (e.what());
             QMessageBox::warning (this, "ERREUR", message);
           }
-        widget.textEditAir -> setPlainText(m_air.getAirportFormatted ().c_str());       
     };
 }
 
@@ -112,9 +149,10 @@ void Airport_Table::slotDeleteFlight()
     DeleteFlight dGUI;
     if (dGUI.exec())
     { 
+        TRACE_SPAN("Airport_Table::slotDeleteFlight");
         try
         {
-            m_air.deleteFlight (dGUI.getNumberDelete ());
+            m_model.deleteFlight (dGUI.getNumberDelete ());
         }
         catch(FlightAbsentException &e)
         {
@@ -122,5 +160,209 @@ void Airport_Table::slotDeleteFlight()
             QMessageBox::critical (this, "ERREUR", message);
         }
     };
-    widget.textEditAir -> setPlainText(m_air.getAirportFormatted ().c_str());     
+}
+
+/**
+ * \brief Slot that loads a CSV schedule in the background.
+ *
+ * Asks for a file, then starts a LoadWorker on the loading thread; a
+ * progress dialog follows the load and its Cancel button stops it.
+ */
+void Airport_Table::slotLoad()
+{
+    if (m_loadWorker != nullptr)
+    {
+        return;
+    }
+    QString path = QFileDialog::getOpenFileName (this, "Load a schedule", QString (), "Schedules (*.csv)");
+    if (path.isEmpty ())
+    {
+        return;
+    }
+    m_loadWorker = new LoadWorker (path, QString::fromStdString (m_air.getCode ()));
+    m_loadWorker->moveToThread (&m_loadThread);
+    connect (m_loadWorker, &LoadWorker::progress, this, &Airport_Table::slotLoadProgress, Qt::QueuedConnection);
+    connect (m_loadWorker, &LoadWorker::loaded, this, &Airport_Table::slotLoaded, Qt::QueuedConnection);
+    connect (m_loadWorker, &LoadWorker::failed, this, &Airport_Table::slotLoadFailed, Qt::QueuedConnection);
+
+    m_loadProgress = new QProgressDialog ("Loading " + path, "Cancel", 0, 1000, this);
+    m_loadProgress->setWindowModality (Qt::WindowModal);
+    m_loadProgress->setMinimumDuration (200);
+    LoadWorker* worker = m_loadWorker;
+    connect (m_loadProgress, &QProgressDialog::canceled, this, [worker] { worker->cancel (); });
+
+    QMetaObject::invokeMethod (m_loadWorker, "load", Qt::QueuedConnection);
+}
+
+/**
+ * \brief Slot following the progress of the running load.
+ *
+ * \param[in] p_bytes The bytes of the file read so far.
+ * \param[in] p_total The size of the file.
+ */
+void Airport_Table::slotLoadProgress(qint64 p_bytes, qint64 p_total)
+{
+    if (m_loadProgress != nullptr && p_total > 0)
+    {
+        m_loadProgress->setValue (static_cast<int> (p_bytes * 1000 / p_total));
+    }
+}
+
+/**
+ * \brief Slot receiving the airport filled by the worker.
+ *
+ * The flights are moved into the airport of the window, not copied; a
+ * cancelled load is dropped and the board left as it was.
+ *
+ * \param[in] p_airport The filled airport.
+ * \param[in] p_report The counts of the rows read, added and rejected.
+ */
+void Airport_Table::slotLoaded(std::shared_ptr<aerien::Airport> p_airport, aerien::LoadReport p_report)
+{
+    TRACE_SPAN("Airport_Table::slotLoaded");
+    endLoad ();
+    if (p_report.m_cancelled)
+    {
+        widget.statusbar->showMessage ("Loading cancelled");
+        return;
+    }
+    m_air = std::move (*p_airport);
+    m_model.reload ();
+    widget.statusbar->showMessage (QString ("%1 flights loaded, %2 duplicates, %3 invalid rows")
+                                   .arg (p_report.m_added).arg (p_report.m_duplicates).arg (p_report.m_invalid));
+}
+
+/**
+ * \brief Slot reporting a load that could not be done.
+ *
+ * \param[in] p_message The reason of the failure.
+ */
+void Airport_Table::slotLoadFailed(const QString& p_message)
+{
+    endLoad ();
+    QMessageBox::critical (this, "ERREUR", p_message);
+}
+
+/**
+ * \brief Closes the progress dialog and releases the worker of the finished load.
+ */
+void Airport_Table::endLoad()
+{
+    delete m_loadProgress;
+    m_loadProgress = nullptr;
+    m_loadWorker->deleteLater ();
+    m_loadWorker = nullptr;
+}
+
+/**
+ * \brief Queues a status change for the next frame; may be called from any thread.
+ *
+ * \param[in] p_number The flight number packed by util::parseNumber.
+ * \param[in] p_status The new status of the arrival.
+ * \return false if the queue is full and the change was dropped.
+ */
+bool Airport_Table::postStatus(std::uint32_t p_number, ArrivalStatus p_status)
+{
+    return m_liveUpdates.tryPush (StatusUpdate{p_number, p_status});
+}
+
+/**
+ * \brief Slot that turns the live mode on or off.
+ *
+ * The live mode applies the queued status changes every LIVE_FRAME_MS, and
+ * feeds the queue with random status changes of the listed arrivals.
+ *
+ * \param[in] p_enabled true to turn the live mode on.
+ */
+void Airport_Table::slotLiveMode(bool p_enabled)
+{
+    stopLiveSource ();
+    if (!p_enabled)
+    {
+        m_liveTimer.stop ();
+        slotApplyLiveUpdates ();
+        widget.statusbar->clearMessage ();
+        return;
+    }
+
+    std::vector<std::uint32_t> arrivals;
+    {
+        Airport::Snapshot board = m_air.getSnapshot ();
+        for (const std::shared_ptr<const Flight>& flight : board->m_flights)
+        {
+            std::uint32_t number;
+            if (dynamic_cast<const Arrival*> (flight.get ()) != nullptr && util::parseNumber (flight->getNumberView (), number))
+            {
+                arrivals.push_back (number);
+            }
+        }
+    }
+    m_liveTimer.start ();
+    widget.statusbar->showMessage (QString ("Live feed: %1 arrivals").arg (arrivals.size ()));
+    if (arrivals.empty ())
+    {
+        return;
+    }
+    m_liveStop = false;
+    m_liveSource = std::thread ([this, arrivals = std::move (arrivals)]
+    {
+        util::setTraceThreadName ("live feed");
+        std::minstd_rand random (arrivals.size ());
+        while (!m_liveStop.load ())
+        {
+            // about a thousand changes per second, in bursts
+            for (int i = 0; i < 8; ++i)
+            {
+                postStatus (arrivals[random () % arrivals.size ()], static_cast<ArrivalStatus> (random () % 3));
+            }
+            std::this_thread::sleep_for (std::chrono::milliseconds (8));
+        }
+    });
+}
+
+/**
+ * \brief Slot of the live timer: applies the status changes queued since the last frame.
+ */
+void Airport_Table::slotApplyLiveUpdates()
+{
+    TRACE_SPAN("Airport_Table::slotApplyLiveUpdates");
+    StatusUpdate update;
+    while (m_liveBatch.size () < LIVE_QUEUE_CAPACITY && m_liveUpdates.tryPop (update))
+    {
+        m_liveBatch.push_back (update);
+    }
+    if (!m_liveBatch.empty ())
+    {
+        m_model.applyStatusUpdates (m_liveBatch.data (), m_liveBatch.size ());
+        m_liveBatch.clear ();
+    }
+}
+
+/**
+ * \brief Slot of the search timer: filters the board by the text of the search field.
+ */
+void Airport_Table::slotSearch()
+{
+    TRACE_SPAN("Airport_Table::slotSearch");
+    m_filter.setQuery (widget.lineEditSearch->text ());
+    if (m_filter.isFiltering ())
+    {
+        widget.statusbar->showMessage (QString ("%1 of %2 flights").arg (m_filter.rowCount ()).arg (m_model.rowCount ()));
+    }
+    else
+    {
+        widget.statusbar->clearMessage ();
+    }
+}
+
+/**
+ * \brief Stops the simulated feed of the live mode, if it runs.
+ */
+void Airport_Table::stopLiveSource()
+{
+    if (m_liveSource.joinable ())
+    {
+        m_liveStop = true;
+        m_liveSource.join ();
+    }
 }
@@ -10,13 +10,35 @@
 
 #include "ui_Airport_Table.h"
 #include "Airport.h"
+#include "FlightFilterModel.h"
+#include "FlightTableModel.h"
+#include "LoadWorker.h"
+#include "mpscQueue.h"
+#include <QProgressDialog>
+#include <QThread>
+#include <QTimer>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 /**
  * @class Airport_Table
  * @brief Main window of the airport management application.
  *
  * This class inherits from QMainWindow and manages the main interface of the application.
- * It allows the user to view and manage the flights of an airport.
+ * It allows the user to view and manage the flights of an airport, shown
+ * by a QTableView over a FlightTableModel. The search field filters the
+ * board through a FlightFilterModel once the typing pauses for
+ * SEARCH_DELAY_MS, so a keystroke only restarts a timer. Schedules are loaded by a
+ * LoadWorker on m_loadThread, so the window stays responsive meanwhile.
+ *
+ * In live mode, the status changes posted by the feeds are queued and a
+ * timer applies them once per frame: one mutation of the airport and one
+ * repaint of the changed rows per frame, however many changes arrived
+ * meanwhile. The frame does not rebuild the board: the model reads the
+ * changed rows by their FlightIds, and the board is published off the UI
+ * thread.
  */
 class Airport_Table : public QMainWindow
 {
@@ -25,17 +47,43 @@ class Airport_Table : public QMainWindow
 public:
   Airport_Table ();
   
-  virtual ~Airport_Table (){};
-  
+  virtual ~Airport_Table ();
+
+  bool postStatus(std::uint32_t p_number, aerien::ArrivalStatus p_status);
+
+  static const int LIVE_FRAME_MS = 16;
+  static const std::size_t LIVE_QUEUE_CAPACITY = 16384;
+  static const int SEARCH_DELAY_MS = 150;
   
   private slots:
     void slotDeparture();
     void slotArrival();
     void slotDeleteFlight();
+    void slotLoad();
+    void slotLoadProgress(qint64 p_bytes, qint64 p_total);
+    void slotLoaded(std::shared_ptr<aerien::Airport> p_airport, aerien::LoadReport p_report);
+    void slotLoadFailed(const QString& p_message);
+    void slotLiveMode(bool p_enabled);
+    void slotApplyLiveUpdates();
+    void slotSearch();
   
 private:
+  void endLoad();
+  void stopLiveSource();
+
   Ui::AirportTable widget;
   aerien::Airport m_air;
+  FlightTableModel m_model;
+  FlightFilterModel m_filter;
+  QTimer m_searchTimer;            ///< Restarted by each keystroke in the search field.
+  QThread m_loadThread;
+  LoadWorker* m_loadWorker;        ///< The running load, owned until its result is received.
+  QProgressDialog* m_loadProgress;
+  util::MpscQueue<aerien::StatusUpdate> m_liveUpdates;  ///< Posted by the feeds, drained by m_liveTimer.
+  std::vector<aerien::StatusUpdate> m_liveBatch;
+  QTimer m_liveTimer;
+  std::thread m_liveSource;                             ///< Simulated feed of the live mode.
+  std::atomic<bool> m_liveStop;
   std::vector<aerien::Flight> m_flights;
 
 };
@@ -0,0 +1,97 @@
+/**
+ * \file   FlightFilterModel.cpp
+ * \brief  File containing the implementation of the FlightFilterModel class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include "FlightFilterModel.h"
+#include "trace.h"
+
+using namespace aerien;
+
+/**
+ * \brief Constructor of the proxy, showing every row until a query is set.
+ *
+ * \param[in] p_source The model filtered; it must outlive the proxy.
+ * \param[in] p_parent The parent of the proxy.
+ */
+FlightFilterModel::FlightFilterModel (FlightTableModel& p_source, QObject* p_parent)
+    : QSortFilterProxyModel (p_parent), m_source (p_source), m_indexStale (true), m_matchesValid (false)
+{
+  // the status changes of the live mode must not cost a pass over the rows
+  setDynamicSortFilter (false);
+  setSourceModel (&m_source);
+  connect (&m_source, &QAbstractItemModel::rowsInserted, this, &FlightFilterModel::slotRowsInserted);
+  // before the change, since the proxy filters the rows of a reset as soon as it is done
+  connect (&m_source, &QAbstractItemModel::rowsAboutToBeRemoved, this, &FlightFilterModel::slotRowsMoved);
+  connect (&m_source, &QAbstractItemModel::modelAboutToBeReset, this, &FlightFilterModel::slotRowsMoved);
+}
+
+/**
+ * \brief Shows only the rows matching a query.
+ *
+ * \param[in] p_query A flight number prefix, or the start of a word of a
+ *            company or city, or a gate; blank, every row is shown.
+ */
+void FlightFilterModel::setQuery (const QString& p_query)
+{
+  TRACE_SPAN ("FlightFilterModel::setQuery");
+  m_query = FlightSearchIndex::normalize (p_query.toUtf8 ().toStdString ());
+  m_matches.clear ();
+  m_matchesValid = false;
+  if (!m_query.empty ())
+    {
+      if (m_indexStale)
+        {
+          m_index = FlightSearchIndex (m_source.flights ());
+          m_indexStale = false;
+        }
+      m_index.search (m_query, m_matches);
+      m_matchesValid = true;
+    }
+  invalidateFilter ();
+}
+
+/**
+ * \brief Tells whether a query hides rows of the source.
+ */
+bool FlightFilterModel::isFiltering () const
+{
+  return !m_query.empty ();
+}
+
+/**
+ * \brief Accepts a row of the source if its flight matches the query.
+ */
+bool FlightFilterModel::filterAcceptsRow (int p_sourceRow, const QModelIndex&) const
+{
+  if (m_query.empty ())
+    {
+      return true;
+    }
+  std::size_t row = static_cast<std::size_t> (p_sourceRow);
+  if (m_matchesValid && row < m_matches.size ())
+    {
+      return m_matches[row];
+    }
+  return FlightSearchIndex::matches (*m_source.flights ()[row], m_query);
+}
+
+/**
+ * \brief Slot called after rows were appended to the source: the rows
+ *        already matched keep their position, the index misses the new ones.
+ */
+void FlightFilterModel::slotRowsInserted ()
+{
+  m_indexStale = true;
+}
+
+/**
+ * \brief Slot called before rows are removed from the source or it is
+ *        reset: the rows matched will no longer have the same position.
+ */
+void FlightFilterModel::slotRowsMoved ()
+{
+  m_indexStale = true;
+  m_matchesValid = false;
+}
@@ -0,0 +1,54 @@
+/**
+ * @file   FlightFilterModel.h
+ * @brief  File containing the declaration of the FlightFilterModel class, the searchable view of a FlightTableModel.
+ * @author Chih Taki-eddine
+ * @date 18 October 2026
+ */
+
+#ifndef _FLIGHTFILTERMODEL_H
+#define _FLIGHTFILTERMODEL_H
+
+#include <QSortFilterProxyModel>
+#include <QString>
+#include <string>
+#include <vector>
+#include "FlightSearchIndex.h"
+#include "FlightTableModel.h"
+
+/**
+ * @class FlightFilterModel
+ * @brief Proxy showing the rows of a FlightTableModel that match a search query.
+ *
+ * A query is answered by a FlightSearchIndex of the rows, built on the first
+ * query after rows were added or removed; filterAcceptsRow() then only reads
+ * the bitmap of the matching rows. Rows appended after the query, or shifted
+ * by a removal, are checked one by one until the next query. Status changes
+ * do not refilter: the status is not searchable.
+ */
+class FlightFilterModel : public QSortFilterProxyModel
+{
+  Q_OBJECT
+
+public:
+  explicit FlightFilterModel (FlightTableModel& p_source, QObject* p_parent = nullptr);
+
+  void setQuery (const QString& p_query);
+  bool isFiltering () const;
+
+protected:
+  bool filterAcceptsRow (int p_sourceRow, const QModelIndex& p_sourceParent) const override;
+
+private slots:
+  void slotRowsInserted ();
+  void slotRowsMoved ();
+
+private:
+  FlightTableModel& m_source;
+  std::string m_query;                 ///< Normalized; empty when not filtering.
+  aerien::FlightSearchIndex m_index;
+  bool m_indexStale;                   ///< Rows were added or removed since m_index was built.
+  std::vector<bool> m_matches;         ///< Result of m_query for the first rows, while m_matchesValid.
+  bool m_matchesValid;
+};
+
+#endif /* _FLIGHTFILTERMODEL_H */
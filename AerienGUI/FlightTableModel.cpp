@@ -0,0 +1,317 @@
+/**
+ * \file   FlightTableModel.cpp
+ * \brief  File containing the implementation of the FlightTableModel class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include "FlightTableModel.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "FlightException.h"
+#include "trace.h"
+#include "validationFormat.h"
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+using namespace aerien;
+
+namespace
+{
+  /**
+   * \brief Converts a field of a flight to a QString.
+   */
+  QString toQString (std::string_view p_field)
+  {
+    return QString::fromUtf8 (p_field.data (), static_cast<int> (p_field.size ()));
+  }
+}
+
+/**
+ * \brief Constructor of the model, showing the flights already listed by the airport.
+ *
+ * \param[in] p_airport The airport presented; it must outlive the model.
+ * \param[in] p_parent The parent of the model.
+ */
+FlightTableModel::FlightTableModel (Airport& p_airport, QObject* p_parent)
+    : QAbstractTableModel (p_parent), m_airport (p_airport), m_nextRank (0), m_ranksIndexed (false)
+{
+  reload ();
+}
+
+/**
+ * \brief Returns the number of flights; a table has no child rows.
+ */
+int FlightTableModel::rowCount (const QModelIndex& p_parent) const
+{
+  return p_parent.isValid () ? 0 : static_cast<int> (m_rows.size ());
+}
+
+/**
+ * \brief Returns the number of columns.
+ */
+int FlightTableModel::columnCount (const QModelIndex& p_parent) const
+{
+  return p_parent.isValid () ? 0 : ColumnCount;
+}
+
+/**
+ * \brief Returns the text of a cell, formatted when the view asks for it.
+ *
+ * \param[in] p_index The cell.
+ * \param[in] p_role Only Qt::DisplayRole is provided.
+ * \return The field of the flight, or an empty QVariant for the columns
+ *         that do not apply to its kind.
+ */
+QVariant FlightTableModel::data (const QModelIndex& p_index, int p_role) const
+{
+  if (p_role != Qt::DisplayRole || !p_index.isValid () || p_index.row () >= rowCount ()
+      || p_index.column () >= ColumnCount)
+    {
+      return QVariant ();
+    }
+  const QString& cell = formatted (p_index.row ()).m_cells[p_index.column ()];
+  return cell.isNull () ? QVariant () : QVariant (cell);
+}
+
+/**
+ * \brief Returns the titles of the columns, those of the formatted board.
+ */
+QVariant FlightTableModel::headerData (int p_section, Qt::Orientation p_orientation, int p_role) const
+{
+  if (p_role != Qt::DisplayRole || p_orientation != Qt::Horizontal)
+    {
+      return QAbstractTableModel::headerData (p_section, p_orientation, p_role);
+    }
+  switch (p_section)
+    {
+    case ColumnNumber:
+      return QStringLiteral ("FLIGHT");
+    case ColumnCompany:
+      return QStringLiteral ("COMPANY");
+    case ColumnHour:
+      return QStringLiteral ("HOUR");
+    case ColumnCity:
+      return QStringLiteral ("CITY");
+    case ColumnBoardingHour:
+      return QStringLiteral ("EMBRQ");
+    case ColumnGate:
+      return QStringLiteral ("GATE");
+    case ColumnStatus:
+      return QStringLiteral ("STATUT");
+    default:
+      return QVariant ();
+    }
+}
+
+/**
+ * \brief Adds a flight to the airport and appends its row.
+ *
+ * \param[in] p_flight The flight to add.
+ * \throws FlightAlreadyExistsException if the flight is already listed.
+ * \throws FlightException if the number of the flight is not valid.
+ * \post Only the inserted row is announced to the views; no row is added
+ *       when the airport refuses the flight.
+ */
+void FlightTableModel::addFlight (const Flight& p_flight)
+{
+  TRACE_SPAN ("FlightTableModel::addFlight");
+  FlightId id;
+  FlightResult result = m_airport.tryAddFlight (p_flight, &id);
+  if (result == FlightResult::AlreadyExists)
+    {
+      throw FlightAlreadyExistsException ("This flight already exists :\n" + p_flight.getNumber ());
+    }
+  if (result != FlightResult::Ok)
+    {
+      throw FlightException ("Invalid flight number :\n" + p_flight.getNumber ());
+    }
+  int row = static_cast<int> (m_rows.size ());
+  beginInsertRows (QModelIndex (), row, row);
+  m_rows.push_back (m_airport.getFlight (id));
+  m_ids.push_back (id);
+  m_ranks.push_back (m_nextRank);
+  if (m_ranksIndexed)
+    {
+      std::uint32_t number;
+      util::parseNumber (p_flight.getNumberView (), number);
+      m_rankOfNumber[number] = m_nextRank;
+    }
+  ++m_nextRank;
+  endInsertRows ();
+}
+
+/**
+ * \brief Deletes a flight from the airport and removes its row.
+ *
+ * The row is found through the rank of its number, by a hash lookup and a
+ * binary search of m_ranks, and the ranks of the other rows do not change.
+ * Removing the row still moves the following ones up in the vectors, a
+ * copy of their pointers and handles, as Qt does for its own rows.
+ *
+ * \param[in] p_number The number of the flight to delete.
+ * \throws FlightAbsentException if no flight has this number.
+ * \post Only the removed row is announced to the views.
+ */
+void FlightTableModel::deleteFlight (const std::string& p_number)
+{
+  TRACE_SPAN ("FlightTableModel::deleteFlight");
+  FlightId id = m_airport.findFlight (p_number);
+  std::uint32_t number = 0;
+  int row = id.isNull () || !util::parseNumber (p_number, number) ? -1 : rowOfNumber (number);
+  if (row < 0 || m_ids[row] != id)
+    {
+      throw FlightAbsentException ("This Flight doesn't exist.");
+    }
+  beginRemoveRows (QModelIndex (), row, row);
+  m_airport.tryDeleteFlight (id);
+  m_rows.erase (m_rows.begin () + row);
+  m_ids.erase (m_ids.begin () + row);
+  m_ranks.erase (m_ranks.begin () + row);
+  m_rankOfNumber.erase (number);
+  endRemoveRows ();
+}
+
+/**
+ * \brief Applies a batch of status changes to the airport and refreshes their rows.
+ *
+ * The batch is a single mutation of the airport, which leaves the new
+ * board to its publication task: the model reads the changed rows through
+ * their FlightIds, so no board is copied nor sorted on the UI thread. The
+ * model announces a single range of rows covering the changed arrivals, so
+ * the view repaints at most once per batch.
+ *
+ * \param[in] p_updates The status changes; those of unknown flights are ignored.
+ * \param[in] p_count The number of status changes.
+ * \return The number of status changes applied.
+ */
+std::size_t FlightTableModel::applyStatusUpdates (const StatusUpdate* p_updates, std::size_t p_count)
+{
+  TRACE_SPAN ("FlightTableModel::applyStatusUpdates");
+  std::size_t applied = m_airport.applyStatusUpdates (p_updates, p_count);
+  if (applied == 0)
+    {
+      return 0;
+    }
+  int first = rowCount ();
+  int last = -1;
+  for (std::size_t i = 0; i < p_count; ++i)
+    {
+      int row = rowOfNumber (p_updates[i].m_number);
+      if (row >= 0)
+        {
+          m_rows[row] = m_airport.getFlight (m_ids[row]);
+          first = std::min (first, row);
+          last = std::max (last, row);
+        }
+    }
+  if (last >= 0)
+    {
+      emit dataChanged (index (first, ColumnStatus), index (last, ColumnStatus));
+    }
+  return applied;
+}
+
+/**
+ * \brief Reloads all the rows from the current board of the airport.
+ *
+ * Meant for changes made to the airport outside of the model.
+ */
+void FlightTableModel::reload ()
+{
+  TRACE_SPAN ("FlightTableModel::reload");
+  beginResetModel ();
+  Airport::Snapshot board = m_airport.getSnapshot ();
+  m_rows = board->m_flights;
+  m_ids = board->m_ids;
+  m_ranks.resize (m_rows.size ());
+  for (std::size_t row = 0; row < m_ranks.size (); ++row)
+    {
+      m_ranks[row] = row;
+    }
+  m_nextRank = m_ranks.size ();
+  m_ranksIndexed = false;
+  m_rowCache.clear ();
+  m_rowCacheIndex.clear ();
+  endResetModel ();
+}
+
+/**
+ * \brief Returns the flight of each row, in the order of the rows.
+ */
+const std::vector<std::shared_ptr<const Flight>>& FlightTableModel::flights () const
+{
+  return m_rows;
+}
+
+/**
+ * \brief Returns the cells of a row, from the LRU of formatted rows.
+ *
+ * A row is looked up by its flight, which a status change replaces, so a
+ * changed row is formatted again and its former cells age out of the LRU.
+ * A missing row takes the place of the least recently used one.
+ */
+const FlightTableModel::FormattedRow& FlightTableModel::formatted (int p_row) const
+{
+  const std::shared_ptr<const Flight>& flight = m_rows[p_row];
+  auto found = m_rowCacheIndex.find (flight.get ());
+  if (found != m_rowCacheIndex.end ())
+    {
+      m_rowCache.splice (m_rowCache.begin (), m_rowCache, found->second);
+      return *found->second;
+    }
+
+  if (m_rowCache.size () < ROW_CACHE_CAPACITY)
+    {
+      m_rowCache.emplace_front ();
+    }
+  else
+    {
+      m_rowCacheIndex.erase (m_rowCache.back ().m_flight.get ());
+      m_rowCache.splice (m_rowCache.begin (), m_rowCache, std::prev (m_rowCache.end ()));
+    }
+  FormattedRow& row = m_rowCache.front ();
+  row.m_flight = flight;
+  row.m_cells[ColumnNumber] = toQString (flight->getNumberView ());
+  row.m_cells[ColumnCompany] = toQString (flight->getCompanyView ());
+  row.m_cells[ColumnHour] = toQString (flight->getHourView ());
+  row.m_cells[ColumnCity] = toQString (flight->getCityView ());
+  const Depart* depart = dynamic_cast<const Depart*> (flight.get ());
+  row.m_cells[ColumnBoardingHour] = depart != nullptr ? toQString (depart->getBoardingHourView ()) : QString ();
+  row.m_cells[ColumnGate] = depart != nullptr ? toQString (depart->getBoardingGateView ()) : QString ();
+  const Arrival* arrival = dynamic_cast<const Arrival*> (flight.get ());
+  row.m_cells[ColumnStatus] = arrival != nullptr ? toQString (arrival->getStatus ()) : QString ();
+  m_rowCacheIndex[flight.get ()] = m_rowCache.begin ();
+  return row;
+}
+
+/**
+ * \brief Returns the row of a flight by its packed number, or -1 if the model
+ *        does not show it.
+ *
+ * The index of the ranks is built on the first lookup after a reload; the
+ * row is the position of the rank in m_ranks, which stays sorted as rows
+ * are appended and removed.
+ */
+int FlightTableModel::rowOfNumber (std::uint32_t p_number)
+{
+  if (!m_ranksIndexed)
+    {
+      m_rankOfNumber.clear ();
+      m_rankOfNumber.reserve (m_rows.size ());
+      for (std::size_t row = 0; row < m_rows.size (); ++row)
+        {
+          std::uint32_t number;
+          util::parseNumber (m_rows[row]->getNumberView (), number);
+          m_rankOfNumber.emplace (number, m_ranks[row]);
+        }
+      m_ranksIndexed = true;
+    }
+  auto found = m_rankOfNumber.find (p_number);
+  if (found == m_rankOfNumber.end ())
+    {
+      return -1;
+    }
+  auto rank = std::lower_bound (m_ranks.begin (), m_ranks.end (), found->second);
+  return rank == m_ranks.end () || *rank != found->second ? -1 : static_cast<int> (rank - m_ranks.begin ());
+}
@@ -0,0 +1,98 @@
+/**
+ * @file   FlightTableModel.h
+ * @brief  File containing the declaration of the FlightTableModel class, the table model of an airport's flights.
+ * @author Chih Taki-eddine
+ * @date 18 October 2026
+ */
+
+#ifndef _FLIGHTTABLEMODEL_H
+#define _FLIGHTTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QString>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Airport.h"
+
+/**
+ * @class FlightTableModel
+ * @brief Table model presenting the flights of an airport, one row per flight.
+ *
+ * The rows follow the insertion order of the airport. The flights are added
+ * and deleted through the model, which announces only the rows that change:
+ * the view then repaints those rows instead of laying out the whole board.
+ * Each row keeps the immutable flight shared with the airport and its
+ * FlightId, so a cell is formatted only when the view shows it. A batch of
+ * status changes announces a single range of changed rows.
+ *
+ * The view asks for the cells of the visible rows on every repaint; the
+ * formatted rows are kept in an LRU of ROW_CACHE_CAPACITY rows, a few
+ * screens, so the memory and the cost of a repaint do not depend on the
+ * size of the board.
+ */
+class FlightTableModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @enum Column
+   * @brief The columns of the table; a departure has no status, an arrival no boarding.
+   */
+  enum Column
+  {
+    ColumnNumber,
+    ColumnCompany,
+    ColumnHour,
+    ColumnCity,
+    ColumnBoardingHour,
+    ColumnGate,
+    ColumnStatus,
+    ColumnCount
+  };
+
+  static const std::size_t ROW_CACHE_CAPACITY = 256;
+
+  explicit FlightTableModel (aerien::Airport& p_airport, QObject* p_parent = nullptr);
+
+  int rowCount (const QModelIndex& p_parent = QModelIndex ()) const override;
+  int columnCount (const QModelIndex& p_parent = QModelIndex ()) const override;
+  QVariant data (const QModelIndex& p_index, int p_role = Qt::DisplayRole) const override;
+  QVariant headerData (int p_section, Qt::Orientation p_orientation, int p_role = Qt::DisplayRole) const override;
+
+  void addFlight (const aerien::Flight& p_flight);
+  void deleteFlight (const std::string& p_number);
+  std::size_t applyStatusUpdates (const aerien::StatusUpdate* p_updates, std::size_t p_count);
+  void reload ();
+
+  const std::vector<std::shared_ptr<const aerien::Flight>>& flights () const;
+
+private:
+  /**
+   * @struct FormattedRow
+   * @brief The cells of a row, formatted from its flight.
+   */
+  struct FormattedRow
+  {
+    std::shared_ptr<const aerien::Flight> m_flight;  ///< Keeps the key of the row in the cache alive.
+    QString m_cells[ColumnCount];                    ///< Null for the columns that do not apply.
+  };
+
+  const FormattedRow& formatted (int p_row) const;
+  int rowOfNumber (std::uint32_t p_number);
+
+  aerien::Airport& m_airport;
+  std::vector<std::shared_ptr<const aerien::Flight>> m_rows;
+  std::vector<aerien::FlightId> m_ids;  ///< Handle of the flight of each row.
+  std::vector<std::uint64_t> m_ranks;   ///< Rank of each row in the insertion order; increasing.
+  std::uint64_t m_nextRank;             ///< Rank of the next appended row.
+  std::unordered_map<std::uint32_t, std::uint64_t> m_rankOfNumber;  ///< Rank of each packed number, while m_ranksIndexed.
+  bool m_ranksIndexed;
+  mutable std::list<FormattedRow> m_rowCache;  ///< Most recently used first.
+  mutable std::unordered_map<const aerien::Flight*, std::list<FormattedRow>::iterator> m_rowCacheIndex;
+};
+
+#endif /* _FLIGHTTABLEMODEL_H */
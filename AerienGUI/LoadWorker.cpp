@@ -0,0 +1,67 @@
+/**
+ * \file   LoadWorker.cpp
+ * \brief  File containing the implementation of the LoadWorker class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include "LoadWorker.h"
+#include "trace.h"
+#include <exception>
+#include <fstream>
+
+using namespace aerien;
+
+/**
+ * \brief Constructor of a worker loading one file.
+ *
+ * \param[in] p_path The path of the CSV schedule.
+ * \param[in] p_code The code of the airport to fill.
+ */
+LoadWorker::LoadWorker (const QString& p_path, const QString& p_code) : m_path (p_path), m_code (p_code)
+{
+}
+
+/**
+ * \brief Asks the loading to stop after its current batch; may be called from any thread.
+ */
+void LoadWorker::cancel ()
+{
+  m_loader.cancel ();
+}
+
+/**
+ * \brief Parses, validates and inserts the schedule into a new airport.
+ *
+ * Emits progress after each batch, then loaded with the airport, which is
+ * only partially filled if the loading was cancelled, or failed if the file
+ * cannot be read or the code is invalid.
+ */
+void LoadWorker::load ()
+{
+  util::setTraceThreadName ("LoadWorker");
+  TRACE_SPAN ("LoadWorker::load");
+  std::ifstream file (m_path.toLocal8Bit ().toStdString (), std::ios::binary);
+  if (!file)
+    {
+      emit failed (tr ("Cannot open %1").arg (m_path));
+      return;
+    }
+  file.seekg (0, std::ios::end);
+  qint64 total = static_cast<qint64> (file.tellg ());
+  file.seekg (0, std::ios::beg);
+
+  try
+    {
+      auto airport = std::make_shared<Airport> (m_code.toStdString ());
+      m_loader.setProgress ([this, total] (std::size_t p_bytes, std::size_t)
+      {
+        emit progress (static_cast<qint64> (p_bytes), total);
+      });
+      LoadReport report = m_loader.loadCsv (file, *airport);
+      emit loaded (airport, report);
+    }
+  catch (std::exception& e)
+    {
+      emit failed (QString::fromUtf8 (e.what ()));
+    }
+}
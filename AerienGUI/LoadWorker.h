@@ -0,0 +1,53 @@
+/**
+ * @file   LoadWorker.h
+ * @brief  File containing the declaration of the LoadWorker class, which loads a schedule off the GUI thread.
+ * @author Chih Taki-eddine
+ * @date 18 October 2026
+ */
+
+#ifndef _LOADWORKER_H
+#define _LOADWORKER_H
+
+#include <QMetaType>
+#include <QObject>
+#include <QString>
+#include <memory>
+#include "Airport.h"
+#include "ScheduleLoader.h"
+
+/**
+ * @class LoadWorker
+ * @brief Loads a CSV schedule into a new Airport, on the thread it was moved to.
+ *
+ * A worker loads one file. Its signals reach the GUI through queued
+ * connections: progress after each batch of the ScheduleLoader, then either
+ * loaded, handing over the filled airport, or failed. cancel() is called
+ * directly from the GUI thread while load() runs.
+ */
+class LoadWorker : public QObject
+{
+  Q_OBJECT
+
+public:
+  LoadWorker (const QString& p_path, const QString& p_code);
+
+  void cancel ();
+
+public slots:
+  void load ();
+
+signals:
+  void progress (qint64 p_bytes, qint64 p_total);
+  void loaded (std::shared_ptr<aerien::Airport> p_airport, aerien::LoadReport p_report);
+  void failed (const QString& p_message);
+
+private:
+  QString m_path;
+  QString m_code;
+  aerien::ScheduleLoader m_loader;
+};
+
+Q_DECLARE_METATYPE (std::shared_ptr<aerien::Airport>)
+Q_DECLARE_METATYPE (aerien::LoadReport)
+
+#endif /* _LOADWORKER_H */
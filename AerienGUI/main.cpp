@@ -10,6 +10,9 @@
 #include "Airport_Table.h"
 #include <QApplication>
 #include "Airport.h"
+#include "trace.h"
+#include <cstdlib>
+#include <fstream>
 
 /**
  * @file main.cpp
@@ -28,6 +31,10 @@
  * This function initializes the Qt application, creates and displays the main window
  * (Airport_Table), and starts the application's event loop.
  *
+ * When the AERIEN_TRACE environment variable names a file, the library and
+ * GUI spans are recorded and written to it, as Chrome trace-event JSON, when
+ * the application quits.
+ *
  * @param argc Number of command-line arguments.
  * @param argv Array of command-line arguments.
  * @return Application exit code.
@@ -37,11 +44,24 @@ int main (int argc, char *argv[])
   // initialize resources, if needed
   // Q_INIT_RESOURCE(resfile);
 
+  const char* tracePath = std::getenv ("AERIEN_TRACE");
+  if (tracePath != nullptr)
+    {
+      util::setTraceThreadName ("GUI");
+      util::setTracingEnabled (true);
+    }
+
   QApplication app (argc, argv);
 
   // create and show your widgets here
   Airport_Table table;
   table.show();
 
-  return app.exec ();
+  int status = app.exec ();
+  if (tracePath != nullptr)
+    {
+      std::ofstream trace (tracePath);
+      util::writeTrace (trace);
+    }
+  return status;
 }
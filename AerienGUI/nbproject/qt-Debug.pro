@@ -8,8 +8,8 @@ CONFIG -= debug_and_release app_bundle lib_bundle
 CONFIG += debug 
 PKGCONFIG +=
 QT = core gui widgets
-SOURCES += AddArrival.cpp AddDeparture.cpp Airport_Table.cpp DeleteFlight.cpp main.cpp
-HEADERS += AddArrival.h AddDeparture.h Airport_Table.h DeleteFlight.h
+SOURCES += AddArrival.cpp AddDeparture.cpp Airport_Table.cpp DeleteFlight.cpp FlightFilterModel.cpp FlightTableModel.cpp LoadWorker.cpp main.cpp
+HEADERS += AddArrival.h AddDeparture.h Airport_Table.h DeleteFlight.h FlightFilterModel.h FlightTableModel.h LoadWorker.h
 FORMS += AddArrival.ui AddDeparture.ui Airport_Table.ui DeleteFlight.ui
 RESOURCES +=
 TRANSLATIONS +=
@@ -22,3 +22,4 @@ QMAKE_CXX = g++
 DEFINES += 
 INCLUDEPATH += ../Sources 
 LIBS += ../Sources/dist/Debug/GNU-Linux/libsources.a  
+CONFIG += c++2a
@@ -12,11 +12,12 @@
 #include <QtCore/QVariant>
 #include <QtWidgets/QAction>
 #include <QtWidgets/QApplication>
+#include <QtWidgets/QLineEdit>
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QMenuBar>
 #include <QtWidgets/QStatusBar>
-#include <QtWidgets/QTextEdit>
+#include <QtWidgets/QTableView>
 #include <QtWidgets/QWidget>
 
 QT_BEGIN_NAMESPACE
@@ -25,11 +26,14 @@ class Ui_AirportTable
 {
 public:
     QAction *actionDelete_Flight;
+    QAction *actionLoad;
+    QAction *actionLive_Feed;
     QAction *actionClose;
     QAction *actionDeparture;
     QAction *actionArrival;
     QWidget *centralwidget;
-    QTextEdit *textEditAir;
+    QLineEdit *lineEditSearch;
+    QTableView *tableViewAir;
     QMenuBar *menubar;
     QMenu *menuMenu;
     QMenu *menuAdd_Flight;
@@ -42,6 +46,11 @@ public:
         AirportTable->resize(800, 600);
         actionDelete_Flight = new QAction(AirportTable);
         actionDelete_Flight->setObjectName(QString::fromUtf8("actionDelete_Flight"));
+        actionLoad = new QAction(AirportTable);
+        actionLoad->setObjectName(QString::fromUtf8("actionLoad"));
+        actionLive_Feed = new QAction(AirportTable);
+        actionLive_Feed->setObjectName(QString::fromUtf8("actionLive_Feed"));
+        actionLive_Feed->setCheckable(true);
         actionClose = new QAction(AirportTable);
         actionClose->setObjectName(QString::fromUtf8("actionClose"));
         actionDeparture = new QAction(AirportTable);
@@ -50,10 +59,16 @@ public:
         actionArrival->setObjectName(QString::fromUtf8("actionArrival"));
         centralwidget = new QWidget(AirportTable);
         centralwidget->setObjectName(QString::fromUtf8("centralwidget"));
-        textEditAir = new QTextEdit(centralwidget);
-        textEditAir->setObjectName(QString::fromUtf8("textEditAir"));
-        textEditAir->setGeometry(QRect(10, 0, 681, 451));
-        textEditAir->setStyleSheet(QString::fromUtf8("font: oblique 10pt \"Monospace\";"));
+        lineEditSearch = new QLineEdit(centralwidget);
+        lineEditSearch->setObjectName(QString::fromUtf8("lineEditSearch"));
+        lineEditSearch->setGeometry(QRect(10, 4, 681, 26));
+        lineEditSearch->setClearButtonEnabled(true);
+        tableViewAir = new QTableView(centralwidget);
+        tableViewAir->setObjectName(QString::fromUtf8("tableViewAir"));
+        tableViewAir->setGeometry(QRect(10, 36, 681, 415));
+        tableViewAir->setStyleSheet(QString::fromUtf8("font: oblique 10pt \"Monospace\";"));
+        tableViewAir->setSelectionBehavior(QAbstractItemView::SelectRows);
+        tableViewAir->setWordWrap(false);
         AirportTable->setCentralWidget(centralwidget);
         menubar = new QMenuBar(AirportTable);
         menubar->setObjectName(QString::fromUtf8("menubar"));
@@ -70,6 +85,8 @@ public:
         menubar->addAction(menuMenu->menuAction());
         menuMenu->addAction(menuAdd_Flight->menuAction());
         menuMenu->addAction(actionDelete_Flight);
+        menuMenu->addAction(actionLoad);
+        menuMenu->addAction(actionLive_Feed);
         menuMenu->addAction(actionClose);
         menuAdd_Flight->addAction(actionDeparture);
         menuAdd_Flight->addAction(actionArrival);
@@ -78,6 +95,8 @@ public:
         QObject::connect(actionClose, SIGNAL(triggered()), AirportTable, SLOT(close()));
         QObject::connect(actionDeparture, SIGNAL(triggered()), AirportTable, SLOT(slotDeparture()));
         QObject::connect(actionArrival, SIGNAL(triggered()), AirportTable, SLOT(slotArrival()));
+        QObject::connect(actionLoad, SIGNAL(triggered()), AirportTable, SLOT(slotLoad()));
+        QObject::connect(actionLive_Feed, SIGNAL(toggled(bool)), AirportTable, SLOT(slotLiveMode(bool)));
         QObject::connect(actionDelete_Flight, SIGNAL(triggered()), AirportTable, SLOT(slotDeleteFlight()));
 
         QMetaObject::connectSlotsByName(AirportTable);
@@ -87,9 +106,12 @@ public:
     {
         AirportTable->setWindowTitle(QCoreApplication::translate("AirportTable", "TableauAeroport", nullptr));
         actionDelete_Flight->setText(QCoreApplication::translate("AirportTable", "Delete", nullptr));
+        actionLoad->setText(QCoreApplication::translate("AirportTable", "Load...", nullptr));
+        actionLive_Feed->setText(QCoreApplication::translate("AirportTable", "Live feed", nullptr));
         actionClose->setText(QCoreApplication::translate("AirportTable", "Close", nullptr));
         actionDeparture->setText(QCoreApplication::translate("AirportTable", "Departure", nullptr));
         actionArrival->setText(QCoreApplication::translate("AirportTable", "Arrival", nullptr));
+        lineEditSearch->setPlaceholderText(QCoreApplication::translate("AirportTable", "Search a flight number, company, city or gate", nullptr));
         menuMenu->setTitle(QCoreApplication::translate("AirportTable", "Menu", nullptr));
         menuAdd_Flight->setTitle(QCoreApplication::translate("AirportTable", "Add ", nullptr));
     } // retranslateUi
@@ -10,39 +10,192 @@
 #include "ContratException.h"
 #include "Arrival.h"
 #include "Depart.h"
+#include "Executor.h"
+#include "metrics.h"
+#include "trace.h"
 #include <algorithm>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <utility>
 #include <vector>
-#include <sstream>
 #include "FlightException.h"
 
 namespace aerien{
     using namespace std;
 
+    namespace
+    {
+      /**
+       * \brief Marks the timed call as failed unless p_result is FlightResult::Ok.
+       * \return p_result.
+       */
+      FlightResult timed(util::OperationTimer& p_timer, FlightResult p_result)
+      {
+        p_timer.result(p_result == FlightResult::Ok);
+        return p_result;
+      }
+
+      /**
+       * \brief Builds an array whose elements are all constructed from p_argument.
+       */
+      template <typename T, typename Argument, size_t... Index>
+      array<T, sizeof...(Index)> filledArray(Argument p_argument, index_sequence<Index...>)
+      {
+        return {{((void) Index, T(p_argument))...}};
+      }
+
+      // A FlightId holds its shard in the low SHARD_BITS bits of m_slot
+      const unsigned SHARD_BITS = 4;
+      static_assert((size_t(1) << SHARD_BITS) == Airport::SHARD_COUNT, "SHARD_BITS must match SHARD_COUNT");
+
+      const uint32_t NO_ENTRY = UINT32_MAX;
+
+      FlightId makeId(size_t p_shard, uint32_t p_slot, uint32_t p_generation)
+      {
+        return FlightId{(p_slot << SHARD_BITS) | static_cast<uint32_t>(p_shard), p_generation};
+      }
+
+      size_t shardOfId(FlightId p_id)
+      {
+        return p_id.m_slot & ((1u << SHARD_BITS) - 1);
+      }
+
+      uint32_t slotOfId(FlightId p_id)
+      {
+        return p_id.m_slot >> SHARD_BITS;
+      }
+
+      uint64_t idKey(FlightId p_id)
+      {
+        return (uint64_t(p_id.m_slot) << 32) | p_id.m_generation;
+      }
+    }
+
     /**
      * \brief Constructor of the Airport class with code validation.
      *
      * \param[in] p_code The code of the airport to create.
+     * \param[in] p_resource The memory resource of the flights and of the indexes.
      * \pre The parameter should not be empty.
      * \pre isValideCode(p_code) must return true.
      */
 
-    Airport::Airport (const std::string& p_code): m_code(p_code) 
+    Airport::Airport (const std::string& p_code, pmr::memory_resource* p_resource):
+      m_code(p_code), m_resource(p_resource), m_shards(makeShards(p_resource)),
+      m_nextSequence(0), m_version(1), m_board(nullptr), m_publishScheduled(false),
+      m_publications(Executor::instance()), m_compactions(Executor::instance())
     { PRECONDITION(p_code != "");
       PRECONDITION(util::isValideCode(p_code));
+      publish();
       POSTCONDITION(m_code == p_code);
       INVARIANTS ();
     }
 
+    /**
+     * \brief Constructor of the Airport class from a compile-time validated code.
+     *
+     * \param[in] p_code The code of the airport to create, e.g. "YUL"_code.
+     * \param[in] p_resource The memory resource of the flights and of the indexes.
+     */
+    Airport::Airport (const util::Code& p_code, pmr::memory_resource* p_resource):
+      m_code(p_code.str()), m_resource(p_resource), m_shards(makeShards(p_resource)),
+      m_nextSequence(0), m_version(1), m_board(nullptr), m_publishScheduled(false),
+      m_publications(Executor::instance()), m_compactions(Executor::instance())
+    {
+      publish();
+      INVARIANTS ();
+    }
+
     /**
      * \brief Copy constructor of the Airport class.
      *
+     * Like the standard containers, the copy uses the default memory resource.
+     *
+     * \param[in] p_Airport The Airport object to copy.
+     * \post The copy lists the same flights.
+     */
+    Airport::Airport (const Airport& p_Airport): Airport(p_Airport, pmr::get_default_resource())
+    {
+    }
+
+    /**
+     * \brief Copy constructor of the Airport class using a given memory resource.
+     *
      * \param[in] p_Airport The Airport object to copy.
-     * \post A deep copy of the flights is made.
+     * \param[in] p_resource The memory resource of the copy.
+     * \post The copy lists the same flights; the flights being immutable, they
+     *       are shared when both airports use the same resource, and copied
+     *       into p_resource otherwise. The copy gives its own FlightIds.
      */
-    Airport::Airport (const Airport& p_Airport): m_code(p_Airport.m_code){ 
-      for (const auto & element : p_Airport.m_flights){
-          addFlight(*element);
+    Airport::Airport (const Airport& p_Airport, pmr::memory_resource* p_resource):
+      m_resource(p_resource), m_shards(makeShards(p_resource)), m_nextSequence(0), m_version(1),
+      m_board(nullptr), m_publishScheduled(false), m_publications(Executor::instance()),
+      m_compactions(Executor::instance())
+    {
+      util::OperationTimer timer(util::Operation::CopyAirport);
+      TRACE_SPAN("Airport::Airport(const Airport&)");
+      bool sameResource = *m_resource == *p_Airport.m_resource;
+      for (size_t i = 0; i < SHARD_COUNT; ++i)
+        {
+          shared_lock<util::SharedMutex> lock(p_Airport.m_shards[i].m_mutex);
+          if (i == 0)
+            {
+              m_code = p_Airport.m_code;
+            }
+          for (const FlightEntry & entry : p_Airport.m_shards[i].m_entries)
+            {
+              if (!entry.m_flight)
+                {
+                  continue;
+                }
+              shared_ptr<const Flight> flight = entry.m_flight;
+              if (!sameResource)
+                {
+                  flight = flight->share(m_resource);
+                }
+              uint32_t slot;
+              m_shards[i].insert(entry.m_key, entry.m_sequence, move(flight), slot);
+            }
+        }
+      m_nextSequence = p_Airport.m_nextSequence.load();
+      publish();
+      INVARIANTS ();
+    }
+
+    /**
+     * \brief Move constructor of the Airport class.
+     *
+     * The flights and their indexes are taken over without copying any flight.
+     *
+     * \param[in,out] p_airport The Airport object to move; it is left without flights.
+     * \post The airport lists the flights of p_airport, in the same order, and
+     *       the FlightIds given by p_airport designate them here.
+     */
+    Airport::Airport (Airport&& p_airport):
+      m_code(p_airport.m_code), m_resource(p_airport.m_resource), m_shards(makeShards(m_resource)),
+      m_nextSequence(p_airport.m_nextSequence.load()), m_version(1), m_board(nullptr),
+      m_publishScheduled(false), m_publications(Executor::instance()), m_compactions(Executor::instance())
+    {
+      TRACE_SPAN("Airport::Airport(Airport&&)");
+      // A pending compaction works on the shards of p_airport
+      p_airport.m_compactions.join();
+      for (size_t i = 0; i < SHARD_COUNT; ++i)
+        {
+          Shard& source = p_airport.m_shards[i];
+          unique_lock<util::SharedMutex> lock(source.m_mutex);
+          // The flights leave the board of p_airport for the board of this airport
+          source.logEntries(ChangeKind::Deleted);
+          m_shards[i].m_index.swap(source.m_index);
+          m_shards[i].m_slots.swap(source.m_slots);
+          m_shards[i].m_entries.swap(source.m_entries);
+          m_shards[i].m_freeSlots.swap(source.m_freeSlots);
+          swap(m_shards[i].m_tombstones, source.m_tombstones);
+          m_shards[i].logEntries(ChangeKind::Added);
         }
+      p_airport.m_version.fetch_add(1);
+      p_airport.publish();
+      publish();
       INVARIANTS ();
     }
 
@@ -51,57 +204,251 @@ namespace aerien{
      *
      * \param[in] p_Airport The Airport object to assign.
      * \return A reference to the assigned Airport object.
-     * \post A deep copy of the flights is made.
+     * \post A deep copy of the flights is made; the FlightIds given before
+     *       by this airport designate no flight anymore.
      */
     const Airport& Airport::operator= (const Airport& p_Airport){
+      util::OperationTimer timer(util::Operation::AssignAirport);
+      TRACE_SPAN("Airport::operator=");
       if (this != &p_Airport)
         {
-          m_code = p_Airport.m_code;
-          m_flights.clear();
-            for (const auto & element : p_Airport.m_flights)
-              {
-                addFlight(*element);
-              }
+          // The copy locks p_Airport, so both airports are never locked together
+          Airport copy(p_Airport, m_resource);
+          takeFlights(copy);
+        }
+      INVARIANTS ();
+      return *this;
+    }
+
+    /**
+     * \brief Move assignment operator for the Airport class.
+     *
+     * When both airports use the same memory resource, no flight is copied;
+     * otherwise the flights are copied into the resource of this airport.
+     *
+     * \param[in,out] p_airport The Airport object to move.
+     * \return A reference to the assigned Airport object.
+     * \post The airport lists the flights of p_airport, which is left without
+     *       flights if they were moved; the FlightIds given before by this
+     *       airport designate no flight anymore.
+     */
+    Airport& Airport::operator= (Airport&& p_airport){
+      util::OperationTimer timer(util::Operation::AssignAirport);
+      TRACE_SPAN("Airport::operator=(Airport&&)");
+      if (this != &p_airport)
+        {
+          if (*m_resource == *p_airport.m_resource)
+            {
+              Airport moved(move(p_airport));
+              takeFlights(moved);
+            }
+          else
+            {
+              Airport copy(p_airport, m_resource);
+              takeFlights(copy);
+            }
         }
       INVARIANTS ();
       return *this;
     }
 
+    /**
+     * \brief Replaces the flights of the airport by those of an airport no
+     *        other thread sees, and publishes them.
+     *
+     * The slots are kept, their generations moving on, so no former FlightId
+     * of this airport resolves.
+     *
+     * \param[in,out] p_source The airport whose flights are taken; it must use
+     *                 the memory resource of this airport.
+     */
+    void Airport::takeFlights(Airport& p_source)
+    {
+      for (size_t i = 0; i < SHARD_COUNT; ++i)
+        {
+          m_shards[i].m_mutex.lock();
+        }
+      m_code = p_source.m_code;
+      for (size_t i = 0; i < SHARD_COUNT; ++i)
+        {
+          m_shards[i].clear();
+          for (FlightEntry& entry : p_source.m_shards[i].m_entries)
+            {
+              if (entry.m_flight)
+                {
+                  uint32_t slot;
+                  m_shards[i].insert(entry.m_key, entry.m_sequence, move(entry.m_flight), slot);
+                }
+            }
+        }
+      m_nextSequence = p_source.m_nextSequence.load();
+      m_version.fetch_add(1);
+      for (size_t i = SHARD_COUNT; i-- > 0; )
+        {
+          m_shards[i].m_mutex.unlock();
+        }
+      publish();
+    }
+
+    /**
+     * \brief Destructor of the Airport class.
+     *
+     * The last board is retired rather than deleted, so a snapshot still held
+     * by a reader stays valid. When the flights come from a memory resource
+     * of the caller, the board is reclaimed at once if no snapshot is open,
+     * so the resource can be released after the airport.
+     */
+    Airport::~Airport ()
+    {
+      // A pending publication would store a board after the last one is retired
+      try
+        {
+          m_publications.join();
+        }
+      catch (...)
+        {
+          // The publication failed: the last board stays the one to retire
+        }
+      util::retireObject(m_board.load());
+      if (*m_resource != *pmr::new_delete_resource())
+        {
+          util::reclaim();
+        }
+    }
+
     /**
      * \brief Accessor to get the airport code.
-     * \return A constant reference to the string containing the airport code.
+     *
+     * The code changes when an airport is assigned to this one, so it is
+     * read under the lock guarding it and returned by value.
+     *
+     * \return A copy of the airport code.
      */
-     const string & Airport::getCode()const{
+     string Airport::getCode()const{
+       shared_lock<util::SharedMutex> lock(m_shards[0].m_mutex);
        return m_code;
      }
 
+    /**
+     * \brief Accessor to get the memory resource of the flights and of the indexes.
+     * \return The resource given at construction.
+     */
+     pmr::memory_resource* Airport::getMemoryResource()const{
+       return m_resource;
+     }
+
 
     /**
      * \brief Adds a flight to the list of airport flights.
      *
      * \param[in] p_flight The flight to add.
      * \post A copy of the flight is added to the list of flights.
+     * \throws FlightAlreadyExistsException if the flight is already listed.
+     * \throws FlightException if the number of the flight is not valid.
      */ 
     void Airport::addFlight(const Flight& p_flight){
-      bool exist = false;
-      
-      for (auto iter=m_flights.begin(); iter<m_flights.end(); iter++)
+      FlightResult result = tryAddFlight(p_flight);
+      if (result == FlightResult::AlreadyExists)
+        {
+          throw FlightAlreadyExistsException("This flight already exists :\n" + p_flight.getNumber());
+        }
+      if (result != FlightResult::Ok)
+        {
+          throw FlightException("Invalid flight number :\n" + p_flight.getNumber());
+        }
+    }
+
+    /**
+     * \brief Adds a flight to the list of airport flights without throwing.
+     *
+     * Meant for imports and replays, where duplicates are expected: a rejected
+     * flight costs neither an exception nor an allocation.
+     *
+     * \param[in] p_flight The flight to add.
+     * \param[out] p_id If not null, receives the handle of the added flight.
+     * \return FlightResult::Ok if a copy of the flight was added,
+     *         FlightResult::AlreadyExists if the flight is already listed,
+     *         FlightResult::InvalidNumber if its number is not a valid flight number.
+     */
+    FlightResult Airport::tryAddFlight(const Flight& p_flight, FlightId* p_id){
+      util::OperationTimer timer(util::Operation::AddFlight);
+      TRACE_SPAN("Airport::tryAddFlight");
+      uint32_t key;
+      if (!util::parseNumber(p_flight.getNumberView(), key))
+        {
+          return timed(timer, FlightResult::InvalidNumber);
+        }
+      size_t index = shardIndex(key);
+      Shard& shard = m_shards[index];
+      unique_lock<util::SharedMutex> lock(shard.m_mutex);
+      if (shard.find(key) != nullptr)
+        {
+          return timed(timer, FlightResult::AlreadyExists);
+        }
+      uint32_t slot;
+      shard.insert(key, m_nextSequence.fetch_add(1, memory_order_relaxed), p_flight.share(m_resource), slot);
+      if (p_id != nullptr)
         {
-          if((**iter) == p_flight)
+          *p_id = makeId(index, slot, shard.m_slots[slot].m_generation);
+        }
+      m_version.fetch_add(1);
+      lock.unlock();
+      schedulePublish();
+      return timed(timer, FlightResult::Ok);
+    }
+    
+    /**
+     * \brief Adds several flights, the shards being filled in parallel.
+     *
+     * The flights are grouped by shard and each shard is filled by a task of
+     * the library Executor, so the copies are made by several threads. The
+     * flights keep the order of p_flights on the board; when a number appears
+     * twice, the first flight is kept.
+     *
+     * \param[in] p_flights The flights to add.
+     * \return The result of each flight, as tryAddFlight would give it.
+     */
+    vector<FlightResult> Airport::tryAddFlights(const vector<const Flight*>& p_flights)
+    {
+      util::OperationTimer timer(util::Operation::AddFlights);
+      TRACE_SPAN("Airport::tryAddFlights");
+      vector<FlightResult> results(p_flights.size(), FlightResult::InvalidNumber);
+      vector<uint32_t> keys(p_flights.size());
+      array<vector<size_t>, SHARD_COUNT> byShard;
+      for (size_t i = 0; i < p_flights.size(); ++i)
+        {
+          if (util::parseNumber(p_flights[i]->getNumberView(), keys[i]))
             {
-              exist = true;
-              break;
+              byShard[shardIndex(keys[i])].push_back(i);
             }
         }
-      if (exist)
+      uint64_t firstSequence = m_nextSequence.fetch_add(p_flights.size());
+
+      auto fillShards = [&](size_t p_begin, size_t p_end)
+      {
+        for (size_t s = p_begin; s < p_end; ++s)
+          {
+            unique_lock<util::SharedMutex> lock(m_shards[s].m_mutex);
+            for (size_t i : byShard[s])
+              {
+                uint32_t slot;
+                bool added = m_shards[s].find(keys[i]) == nullptr
+                             && m_shards[s].insert(keys[i], firstSequence + i, p_flights[i]->share(m_resource), slot);
+                results[i] = added ? FlightResult::Ok : FlightResult::AlreadyExists;
+              }
+          }
+      };
+      if (p_flights.size() < PARALLEL_RENDER_ROWS / 4)
         {
-          throw FlightAlreadyExistsException("This flight already exists :\n" + p_flight.getNumber());
+          fillShards(0, SHARD_COUNT);
         }
       else
         {
-          m_flights.push_back(p_flight.clone());
+          Executor::instance().parallelFor(0, SHARD_COUNT, 1, fillShards);
         }
-      
+      m_version.fetch_add(1);
+      schedulePublish();
+      return results;
     }
     
     /**
@@ -109,50 +456,193 @@ namespace aerien{
      *
      * This method generates and returns a formatted string representing
      * all airport flights, categorized into departures and arrivals.
+     * The flights are those of a snapshot, which holds every mutation made so far.
      *
      * \return A formatted string representing the airport flights information.
      */
     string Airport::getAirportFormatted() const 
     {
-        ostringstream osDeparture;
-        ostringstream osArrival;
+        util::OperationTimer timer(util::Operation::AirportFormatted);
+        TRACE_SPAN("Airport::getAirportFormatted");
+        // The board of the snapshot cannot change, no lock is needed
+        Snapshot board = getSnapshot();
+        return formatBoard(*board);
+    }
 
-         // Add header for departures
-        osDeparture << "Departure schedule\n";
-        osDeparture << "------------------------------------------------------------------\n";
-        osDeparture << "| FLIGHT  |  COMPANY       |HOUR|         CITY       |EMBRQ|GATE |\n";
-        osDeparture << "------------------------------------------------------------------\n";    
+    namespace
+    {
+      const char DEPARTURE_HEADER[] =
+          "Departure schedule\n"
+          "------------------------------------------------------------------\n"
+          "| FLIGHT  |  COMPANY       |HOUR|         CITY       |EMBRQ|GATE |\n"
+          "------------------------------------------------------------------\n";
+      const char DEPARTURE_FOOTER[] =
+          "------------------------------------------------------------------\n";
+      const char ARRIVAL_HEADER[] =
+          "Arrivals schedule\n"
+          "----------------------------------------------------------------\n"
+          "|FLIGHT|     COMPANY       |HOUR|        CITY        |  STATUT |\n"
+          "----------------------------------------------------------------\n";
+      const char ARRIVAL_FOOTER[] =
+          "----------------------------------------------------------------\n";
 
-        // Add header for arrivals    
-        osArrival <<"Arrivals schedule\n";
-        osArrival <<"----------------------------------------------------------------\n";
-        osArrival <<"|FLIGHT|     COMPANY       |HOUR|        CITY        |  STATUT |\n";
-        osArrival <<"----------------------------------------------------------------\n";
+      /**
+       * \brief Rows of a range of flights, split into the two sections of the board.
+       */
+      struct Sections
+      {
+        string m_departures;
+        string m_arrivals;
+      };
 
-        for (const auto& Flight : m_flights) {
-            string flight_Info = Flight->getFlightFormatted();
+      /**
+       * \brief Formats the flights [p_begin, p_end) of a board.
+       *
+       * A row of 66 characters is a departure, a row of 64 or 65 an arrival
+       * (65 when the status holds a two-byte character).
+       */
+      Sections formatRows(const Airport::Board& p_board, size_t p_begin, size_t p_end)
+      {
+        TRACE_SPAN("Airport::formatRows");
+        Sections sections;
+        sections.m_departures.reserve((p_end - p_begin) * 67);
+        sections.m_arrivals.reserve((p_end - p_begin) * 66);
+        for (size_t i = p_begin; i < p_end; ++i) {
+            string flight_Info = p_board.m_flights[i]->getFlightFormatted();
             if (flight_Info.length() == 66) 
             { 
-                osDeparture << flight_Info << endl;
+                sections.m_departures += flight_Info;
+                sections.m_departures += '\n';
             } else if (flight_Info.length() == 64 || flight_Info.length() == 65 ) 
             { 
-                osArrival << flight_Info << endl;
+                sections.m_arrivals += flight_Info;
+                sections.m_arrivals += '\n';
             }
         }
+        return sections;
+      }
 
-        // Add end line for departures
-        osDeparture << "------------------------------------------------------------------\n";
+      /**
+       * \brief Formats the rows of one section of the flights [p_begin, p_end) of a board.
+       *
+       * Only the flights of the section are formatted: the rows kept are those
+       * formatRows() puts in the same section, a flight of the other kind is
+       * skipped without being formatted.
+       *
+       * \param[in] p_departures true for the departures, false for the arrivals.
+       */
+      string formatSection(const Airport::Board& p_board, size_t p_begin, size_t p_end, bool p_departures)
+      {
+        TRACE_SPAN("Airport::formatSection");
+        string section;
+        section.reserve((p_end - p_begin) * 67);
+        for (size_t i = p_begin; i < p_end; ++i) {
+            const Flight& flight = *p_board.m_flights[i];
+            if ((dynamic_cast<const Depart*>(&flight) != nullptr) != p_departures)
+            {
+                continue;
+            }
+            string flight_Info = flight.getFlightFormatted();
+            if (p_departures ? flight_Info.length() == 66
+                             : flight_Info.length() == 64 || flight_Info.length() == 65)
+            {
+                section += flight_Info;
+                section += '\n';
+            }
+        }
+        return section;
+      }
+    }
 
-        // Add end line for arrivals
-        osArrival << "----------------------------------------------------------------\n";
+    /**
+     * \brief Formats a published board.
+     *
+     * Boards of more than PARALLEL_RENDER_ROWS flights are cut into chunks
+     * formatted by the library Executor; the chunks are stitched back in order,
+     * so the text is the same as with a single thread.
+     *
+     * \param[in] p_board The board to format.
+     * \param[in] p_threads The number of chunks; 0 lets the size of the board
+     *            and the size of the executor decide.
+     * \return A formatted string representing the airport flights information.
+     */
+    string Airport::formatBoard(const Board& p_board, size_t p_threads)
+    {
+        TRACE_SPAN("Airport::formatBoard");
+        size_t count = p_board.m_flights.size();
+        size_t threads = p_threads;
+        if (threads == 0)
+        {
+            threads = min<size_t>(Executor::instance().size() + 1,
+                                  (count + PARALLEL_RENDER_ROWS - 1) / PARALLEL_RENDER_ROWS);
+        }
+        threads = max<size_t>(1, min(threads, count));
 
-        // Concatenate the two output streams
-        ostringstream osFinal;
-        osFinal << "Airport " << m_code << "\n\n";
-        osFinal << osDeparture.str();
-        osFinal << osArrival.str();
+        // The calling thread formats the first chunk, the executor the others
+        vector<Sections> chunks(threads);
+        {
+            Executor::TaskGroup group(Executor::instance());
+            for (size_t t = 1; t < threads; ++t)
+            {
+                group.fork([&chunks, &p_board, count, threads, t]
+                {
+                    chunks[t] = formatRows(p_board, count * t / threads, count * (t + 1) / threads);
+                });
+            }
+            chunks[0] = formatRows(p_board, 0, count / threads);
+            group.join();
+        }
 
-        return osFinal.str();
+        size_t length = p_board.m_code.size() + sizeof(DEPARTURE_HEADER) + sizeof(DEPARTURE_FOOTER)
+                        + sizeof(ARRIVAL_HEADER) + sizeof(ARRIVAL_FOOTER) + 16;
+        for (const Sections& chunk : chunks)
+        {
+            length += chunk.m_departures.size() + chunk.m_arrivals.size();
+        }
+        string board;
+        board.reserve(length);
+        board += "Airport ";
+        board += p_board.m_code;
+        board += "\n\n";
+        board += DEPARTURE_HEADER;
+        for (const Sections& chunk : chunks)
+        {
+            board += chunk.m_departures;
+        }
+        board += DEPARTURE_FOOTER;
+        board += ARRIVAL_HEADER;
+        for (const Sections& chunk : chunks)
+        {
+            board += chunk.m_arrivals;
+        }
+        board += ARRIVAL_FOOTER;
+        return board;
+    }
+
+    /**
+     * \brief Writes a published board to a stream, as formatBoard() formats it.
+     *
+     * The rows are written by blocks of PARALLEL_RENDER_ROWS, the departures
+     * then the arrivals, so the memory used does not grow with the board.
+     * Each pass formats only the flights of its own section.
+     *
+     * \param[out] p_os The stream written.
+     * \param[in] p_board The board to write.
+     */
+    void Airport::writeBoard(ostream& p_os, const Board& p_board)
+    {
+        TRACE_SPAN("Airport::writeBoard");
+        p_os << "Airport " << p_board.m_code << "\n\n";
+        for (bool departures : {true, false})
+        {
+            p_os << (departures ? DEPARTURE_HEADER : ARRIVAL_HEADER);
+            size_t count = p_board.m_flights.size();
+            for (size_t begin = 0; begin < count; begin += PARALLEL_RENDER_ROWS)
+            {
+                p_os << formatSection(p_board, begin, min(count, begin + PARALLEL_RENDER_ROWS), departures);
+            }
+            p_os << (departures ? DEPARTURE_FOOTER : ARRIVAL_FOOTER);
+        }
     }
     
     /**
@@ -177,40 +667,794 @@ namespace aerien{
     /**
      * \brief Deletes a flight from the airport based on its flight number.
      * 
-     * This function iterates over the vector of unique pointers to Flight objects (`m_flights`).
-     * It compares the flight number of each Flight object with the provided flight number (`p_number`).
-     * If a match is found, the corresponding Flight object is removed from the vector.
+     * Throwing wrapper of tryDeleteFlight().
      * 
      * \param[in] p_number The flight number of the flight to delete.
      * \pre isValideNumero(p_number) must return true.
      * \post The flight is removed from the list if it exists.
      * \throws VolAbsentException if the flight does not exist.
-     * 
-     * \note This function uses std::unique_ptr for managing Flight objects.
+     * \throws FlightException if p_number is not valid and the precondition is not checked.
      */
     void Airport::deleteFlight(const std::string& p_number)
     {   
         PRECONDITION(util::isValidNumber(p_number))
-        bool Exist = false;
+        FlightResult result = tryDeleteFlight(p_number);
+        if (result == FlightResult::Absent) 
+        {
+            throw FlightAbsentException("This Flight doesn't exist."); 
+        }
+        if (result != FlightResult::Ok)
+        {
+            throw FlightException("Invalid flight number :\n" + p_number);
+        }
+    }
 
-            for (auto iter = m_flights.begin(); iter != m_flights.end(); ) 
+    /**
+     * \brief Deletes a flight from the airport without throwing.
+     *
+     * \param[in] p_number The flight number of the flight to delete.
+     * \return FlightResult::Ok if the flight was removed,
+     *         FlightResult::Absent if no flight has this number,
+     *         FlightResult::InvalidNumber if p_number is not a valid flight number.
+     */
+    FlightResult Airport::tryDeleteFlight(const std::string& p_number)
+    {
+        util::OperationTimer timer(util::Operation::DeleteFlight);
+        TRACE_SPAN("Airport::tryDeleteFlight");
+        uint32_t key;
+        if (!util::parseNumber(p_number, key))
+        {
+            return timed(timer, FlightResult::InvalidNumber);
+        }
+        size_t index = shardIndex(key);
+        unique_lock<util::SharedMutex> lock(m_shards[index].m_mutex);
+        return timed(timer, deleteEntry(index, m_shards[index].find(key)));
+    }
+
+    /**
+     * \brief Deletes a flight designated by its handle, without throwing.
+     *
+     * \param[in] p_id The handle given when the flight was added or found.
+     * \return FlightResult::Ok if the flight was removed,
+     *         FlightResult::Absent if the handle designates no flight anymore.
+     */
+    FlightResult Airport::tryDeleteFlight(FlightId p_id)
+    {
+        util::OperationTimer timer(util::Operation::DeleteFlight);
+        TRACE_SPAN("Airport::tryDeleteFlight");
+        size_t index = shardOfId(p_id);
+        unique_lock<util::SharedMutex> lock(m_shards[index].m_mutex);
+        return timed(timer, deleteEntry(index, m_shards[index].find(slotOfId(p_id), p_id.m_generation)));
+    }
+
+    /**
+     * \brief Leaves a tombstone in place of a flight, and schedules the
+     *        compaction of its shard when the tombstones pile up.
+     *
+     * \pre The caller holds the lock of the shard exclusively.
+     * \param[in] p_shard The index of the shard of the flight.
+     * \param[in] p_entry The entry of the flight, or nullptr.
+     * \return FlightResult::Ok, or FlightResult::Absent if p_entry is null.
+     */
+    FlightResult Airport::deleteEntry(size_t p_shard, FlightEntry* p_entry)
+    {
+        if (p_entry == nullptr)
+        {
+            return FlightResult::Absent;
+        }
+        Shard& shard = m_shards[p_shard];
+        shard.erase(*p_entry);
+        m_version.fetch_add(1);
+        schedulePublish();
+        if (shard.needsCompaction())
+        {
+            shard.m_compactionScheduled = true;
+            m_compactions.fork([this, p_shard]
             {
-                const std::unique_ptr<Flight>& ptrFlight = *iter;
+                TRACE_SPAN("Airport::compact");
+                Shard& compacted = m_shards[p_shard];
+                unique_lock<util::SharedMutex> shardLock(compacted.m_mutex);
+                compacted.compact();
+            });
+        }
+        return FlightResult::Ok;
+    }
+
+    /**
+     * \brief Changes the status of an arrival.
+     *
+     * Meant for a status feed running beside the display threads.
+     *
+     * \param[in] p_number The flight number of the arrival.
+     * \param[in] p_status The new status of the arrival.
+     * \return FlightResult::Ok if the status was changed, otherwise the reason
+     *         why it was not (InvalidNumber, InvalidStatus, Absent, NotArrival).
+     */
+    FlightResult Airport::setFlightStatus(const std::string& p_number, const std::string& p_status)
+    {
+        util::OperationTimer timer(util::Operation::SetFlightStatus);
+        TRACE_SPAN("Airport::setFlightStatus");
+        uint32_t key;
+        if (!util::parseNumber(p_number, key))
+        {
+            return timed(timer, FlightResult::InvalidNumber);
+        }
+        if (!util::isValidStatus(p_status))
+        {
+            return timed(timer, FlightResult::InvalidStatus);
+        }
+        FlightResult result = updateStatus(key, p_status);
+        if (result == FlightResult::Ok)
+        {
+            m_version.fetch_add(1);
+            schedulePublish();
+        }
+        return timed(timer, result);
+    }
+
+    /**
+     * \brief Changes the status of an arrival designated by its handle.
+     *
+     * \param[in] p_id The handle of the arrival.
+     * \param[in] p_status The new status of the arrival.
+     * \return FlightResult::Ok if the status was changed, otherwise the reason
+     *         why it was not (InvalidStatus, Absent, NotArrival).
+     */
+    FlightResult Airport::setFlightStatus(FlightId p_id, const std::string& p_status)
+    {
+        util::OperationTimer timer(util::Operation::SetFlightStatus);
+        TRACE_SPAN("Airport::setFlightStatus");
+        if (!util::isValidStatus(p_status))
+        {
+            return timed(timer, FlightResult::InvalidStatus);
+        }
+        FlightResult result;
+        {
+            Shard& shard = m_shards[shardOfId(p_id)];
+            unique_lock<util::SharedMutex> lock(shard.m_mutex);
+            result = updateEntry(shard, shard.find(slotOfId(p_id), p_id.m_generation), p_status);
+        }
+        if (result == FlightResult::Ok)
+        {
+            m_version.fetch_add(1);
+            schedulePublish();
+        }
+        return timed(timer, result);
+    }
 
-                if (ptrFlight->getNumber() == p_number) 
-                    {
-                        iter = m_flights.erase(iter); 
-                        Exist = true;
-                    } 
-                else 
-                    {
-                        ++iter; // Incrémente l'itérateur seulement si aucun vol n'est supprimé
-                    }
+    /**
+     * \brief Applies a batch of status changes, counted as a single mutation.
+     *
+     * The board is not rebuilt here: the batch is published with the other
+     * pending mutations (see schedulePublish()), so a feed applying batches
+     * at a high rate does not sort the board once per batch. The updates of
+     * unknown flights or of departures are skipped.
+     *
+     * \param[in] p_updates The status changes, applied in order.
+     * \param[in] p_count The number of status changes.
+     * \return The number of status changes applied.
+     */
+    size_t Airport::applyStatusUpdates(const StatusUpdate* p_updates, size_t p_count)
+    {
+        util::OperationTimer timer(util::Operation::ApplyStatusUpdates);
+        TRACE_SPAN("Airport::applyStatusUpdates");
+        size_t applied = 0;
+        for (size_t i = 0; i < p_count; ++i)
+        {
+            if (updateStatus(p_updates[i].m_number, statusText(p_updates[i].m_status)) == FlightResult::Ok)
+            {
+                ++applied;
             }
-        if (!Exist) 
+        }
+        if (applied != 0)
         {
-            throw FlightAbsentException("This Flight doesn't exist."); 
+            m_version.fetch_add(1);
+            schedulePublish();
         }
+        return applied;
+    }
+
+    /**
+     * \brief Changes the status of an arrival in its shard, without publishing.
+     *
+     * \param[in] p_key The flight number packed by util::parseNumber.
+     * \param[in] p_status A valid arrival status.
+     * \return FlightResult::Ok, Absent or NotArrival.
+     */
+    FlightResult Airport::updateStatus(uint32_t p_key, const std::string& p_status)
+    {
+        Shard& shard = shardOf(p_key);
+        unique_lock<util::SharedMutex> lock(shard.m_mutex);
+        return updateEntry(shard, shard.find(p_key), p_status);
+    }
+
+    /**
+     * \brief Changes the status of the arrival of an entry, without publishing.
+     *
+     * \pre The caller holds the lock of the shard of the entry exclusively.
+     * \param[in,out] p_shard The shard of the entry.
+     * \param[in] p_entry The entry of the flight, or nullptr.
+     * \param[in] p_status A valid arrival status.
+     * \return FlightResult::Ok, Absent or NotArrival.
+     */
+    FlightResult Airport::updateEntry(Shard& p_shard, FlightEntry* p_entry, const std::string& p_status)
+    {
+        if (p_entry == nullptr)
+        {
+            return FlightResult::Absent;
+        }
+        if (dynamic_cast<const Arrival*>(p_entry->m_flight.get()) == nullptr)
+        {
+            return FlightResult::NotArrival;
+        }
+        // Copy on write: the published boards keep the previous version of the flight
+        shared_ptr<Flight> updated = p_entry->m_flight->share(m_resource);
+        static_cast<Arrival&>(*updated).setStatus(p_status);
+        p_shard.replace(*p_entry, move(updated));
+        return FlightResult::Ok;
+    }
+
+    /**
+     * \brief Looks up a flight by its number.
+     *
+     * \param[in] p_number The flight number to look for.
+     * \return A copy of the flight, or nullptr if no flight has this number.
+     */
+    unique_ptr<Flight> Airport::getFlight(const std::string& p_number) const
+    {
+        util::OperationTimer timer(util::Operation::GetFlight);
+        uint32_t key;
+        if (!util::parseNumber(p_number, key))
+        {
+            timer.fail();
+            return nullptr;
+        }
+        const Shard& shard = shardOf(key);
+        shared_lock<util::SharedMutex> lock(shard.m_mutex);
+        const FlightEntry* entry = shard.find(key);
+        if (entry == nullptr)
+        {
+            timer.fail();
+            return nullptr;
+        }
+        return entry->m_flight->clone();
+    }
+
+    /**
+     * \brief Reaches a flight by its handle.
+     *
+     * \param[in] p_id The handle of the flight.
+     * \return The flight itself, shared and immutable, or nullptr if the handle
+     *         designates no flight anymore. Like a snapshot, the flight may
+     *         live in the memory resource of the airport.
+     */
+    shared_ptr<const Flight> Airport::getFlight(FlightId p_id) const
+    {
+        util::OperationTimer timer(util::Operation::GetFlight);
+        const Shard& shard = m_shards[shardOfId(p_id)];
+        shared_lock<util::SharedMutex> lock(shard.m_mutex);
+        const FlightEntry* entry = shard.find(slotOfId(p_id), p_id.m_generation);
+        if (entry == nullptr)
+        {
+            timer.fail();
+            return nullptr;
+        }
+        return entry->m_flight;
+    }
+
+    /**
+     * \brief Looks up the handle of a flight by its number.
+     *
+     * \param[in] p_number The flight number to look for.
+     * \return The handle of the flight, or a null FlightId if no flight has this number.
+     */
+    FlightId Airport::findFlight(const std::string& p_number) const
+    {
+        util::OperationTimer timer(util::Operation::FindFlight);
+        uint32_t key;
+        if (!util::parseNumber(p_number, key))
+        {
+            timer.fail();
+            return FlightId();
+        }
+        size_t index = shardIndex(key);
+        const Shard& shard = m_shards[index];
+        shared_lock<util::SharedMutex> lock(shard.m_mutex);
+        const FlightEntry* entry = shard.find(key);
+        if (entry == nullptr)
+        {
+            timer.fail();
+            return FlightId();
+        }
+        return makeId(index, entry->m_slot, shard.m_slots[entry->m_slot].m_generation);
+    }
+
+    /**
+     * \brief Returns the number of flights of the airport.
+     * \return The number of departures and arrivals listed.
+     */
+    size_t Airport::getFlightCount() const
+    {
+        util::OperationTimer timer(util::Operation::GetFlightCount);
+        size_t count = 0;
+        for (const Shard& shard : m_shards)
+        {
+            shared_lock<util::SharedMutex> lock(shard.m_mutex);
+            count += shard.m_index.size();
+        }
+        return count;
+    }
+
+    /**
+     * \brief Computes the memory held by the airport and its flights.
+     *
+     * Each flight costs its object with its shared_ptr control block, and its
+     * long strings; each shard its hash table nodes and buckets. The board is the
+     * last published one, whose flights are those of the shards.
+     *
+     * \return The breakdown, in bytes.
+     */
+    MemoryUsage Airport::memoryUsage() const
+    {
+        // A node of the shard indexes: next pointer, then key and slot
+        struct IndexNode
+        {
+            void* m_next;
+            pair<const uint32_t, uint32_t> m_value;
+        };
+        // Control block made by allocate_shared: vtable pointer and two counters, in the block of the flight
+        const size_t controlBlock = sizeof(void*) + 2 * sizeof(int);
+
+        MemoryUsage usage;
+        usage.m_index += sizeof(m_shards);
+        usage.addString(getCode());
+        for (const Shard& shard : m_shards)
+        {
+            shared_lock<util::SharedMutex> lock(shard.m_mutex);
+            if (shard.m_index.bucket_count() > 1)
+            {
+                usage.m_index += shard.m_index.bucket_count() * sizeof(void*);
+                usage.addAllocation(shard.m_index.bucket_count() * sizeof(void*));
+            }
+            usage.m_index += shard.m_index.size() * sizeof(IndexNode);
+            usage.m_index += shard.m_slots.size() * sizeof(Slot) + shard.m_entries.size() * sizeof(FlightEntry)
+                             + shard.m_freeSlots.size() * sizeof(uint32_t);
+            usage.m_slack += (shard.m_slots.capacity() - shard.m_slots.size()) * sizeof(Slot)
+                             + (shard.m_entries.capacity() - shard.m_entries.size()) * sizeof(FlightEntry)
+                             + (shard.m_freeSlots.capacity() - shard.m_freeSlots.size()) * sizeof(uint32_t);
+            for (size_t capacity : {shard.m_slots.capacity() * sizeof(Slot),
+                                    shard.m_entries.capacity() * sizeof(FlightEntry),
+                                    shard.m_freeSlots.capacity() * sizeof(uint32_t)})
+            {
+                if (capacity != 0)
+                {
+                    usage.addAllocation(capacity);
+                }
+            }
+            for (const FlightEntry& entry : shard.m_entries)
+            {
+                if (!entry.m_flight)
+                {
+                    continue;
+                }
+                usage.addAllocation(sizeof(IndexNode));
+                usage.m_objects += controlBlock;
+                entry.m_flight->addMemoryUsage(usage);
+                ++usage.m_flights;
+            }
+        }
+
+        Snapshot board = getSnapshot();
+        size_t pointers = sizeof(shared_ptr<const Flight>);
+        usage.m_board += sizeof(Board) + board->m_flights.size() * (pointers + sizeof(FlightId) + sizeof(uint64_t));
+        usage.m_slack += (board->m_flights.capacity() - board->m_flights.size()) * pointers
+                         + (board->m_ids.capacity() - board->m_ids.size()) * sizeof(FlightId)
+                         + (board->m_sequences.capacity() - board->m_sequences.size()) * sizeof(uint64_t);
+        usage.addAllocation(sizeof(Board));
+        if (board->m_flights.capacity() != 0)
+        {
+            usage.addAllocation(board->m_flights.capacity() * pointers);
+            usage.addAllocation(board->m_ids.capacity() * sizeof(FlightId));
+            usage.addAllocation(board->m_sequences.capacity() * sizeof(uint64_t));
+        }
+        usage.addString(board->m_code);
+        return usage;
+    }
+
+    /**
+     * \brief Takes a snapshot of the board, with every mutation counted so far.
+     * \return A reference to the board, valid while the snapshot lives; it is
+     *         lock-free unless mutations were still waiting for their publication.
+     */
+    Airport::Snapshot Airport::getSnapshot() const
+    {
+        util::OperationTimer timer(util::Operation::GetSnapshot);
+        return Snapshot(*this);
+    }
+
+    /**
+     * \brief Constructor of a snapshot: enters the reader epoch, then loads the board.
+     *
+     * A board older than the version of the airport misses mutations that may
+     * have been made by this thread, so they are published first.
+     *
+     * \param[in] p_airport The airport whose board is referenced.
+     */
+    Airport::Snapshot::Snapshot(const Airport& p_airport): m_board(p_airport.m_board.load())
+    {
+        if (m_board->m_version < p_airport.m_version.load())
+        {
+            p_airport.publish();
+            m_board = p_airport.m_board.load();
+        }
+    }
+
+    /**
+     * \brief Publishes at once a board holding the flights of all the shards.
+     *
+     * The mutations leave their publication to a task (see schedulePublish()),
+     * unless a snapshot needs them first. The publications are serialized and
+     * coalesced: a board built after a mutation counted in m_version contains
+     * it, so a caller finding its version already published returns at once.
+     *
+     * The new board is the previous one with the changes logged by the shards
+     * applied: the flights are copied once, the added flights sorted and
+     * merged in, so the cost grows with the board and the number of changes,
+     * not with a sort of the whole board. The replaced board is retired.
+     */
+    void Airport::publish() const
+    {
+        lock_guard<mutex> lock(m_publishMutex);
+        uint64_t version = m_version.load();
+        const Board* current = m_board.load();
+        if (current != nullptr && current->m_version >= version)
+        {
+            return;
+        }
+        TRACE_SPAN("Airport::publish");
+
+        // The logs are taken under the shard locks, then applied without any lock
+        struct Listed
+        {
+            uint64_t m_sequence;
+            shared_ptr<const Flight> m_flight;  // null for a deleted flight
+            FlightId m_id;
+        };
+        vector<Listed> added;
+        unordered_map<uint64_t, Listed> changed;  // last version of the other flights, by handle
+        unique_ptr<Board> board(new Board);
+        board->m_version = version;
+        for (size_t i = 0; i < SHARD_COUNT; ++i)
+        {
+            vector<Change> changes;
+            {
+                unique_lock<util::SharedMutex> shardLock(m_shards[i].m_mutex);
+                if (i == 0)
+                {
+                    board->m_code = m_code;
+                }
+                changes.swap(m_shards[i].m_changes);
+            }
+            for (Change& change : changes)
+            {
+                FlightId id = makeId(i, change.m_slot, change.m_generation);
+                if (change.m_kind == ChangeKind::Added)
+                {
+                    added.push_back(Listed{change.m_sequence, move(change.m_flight), id});
+                }
+                else
+                {
+                    changed[idKey(id)] = Listed{change.m_sequence, move(change.m_flight), id};
+                }
+            }
+        }
+
+        // A flight added since the last board takes its last version; the
+        // others are found on the current board by their rank
+        if (!changed.empty())
+        {
+            for (Listed& flight : added)
+            {
+                auto found = changed.find(idKey(flight.m_id));
+                if (found != changed.end())
+                {
+                    flight.m_flight = move(found->second.m_flight);
+                    changed.erase(found);
+                }
+            }
+        }
+        added.erase(remove_if(added.begin(), added.end(), [](const Listed& p_flight) { return !p_flight.m_flight; }),
+                    added.end());
+        sort(added.begin(), added.end(),
+             [](const Listed& p_a, const Listed& p_b)
+             {
+               return p_a.m_sequence < p_b.m_sequence;
+             });
+        size_t previous = current == nullptr ? 0 : current->m_flights.size();
+        vector<pair<size_t, shared_ptr<const Flight>>> replaced;
+        for (auto& flight : changed)
+        {
+            auto position = lower_bound(current->m_sequences.begin(), current->m_sequences.end(),
+                                        flight.second.m_sequence);
+            ASSERTION(position != current->m_sequences.end() && *position == flight.second.m_sequence);
+            replaced.emplace_back(position - current->m_sequences.begin(), move(flight.second.m_flight));
+        }
+        sort(replaced.begin(), replaced.end(),
+             [](const auto& p_a, const auto& p_b)
+             {
+               return p_a.first < p_b.first;
+             });
+
+        // The current board and the added flights are both in insertion order: they are merged
+        board->m_flights.reserve(previous + added.size());
+        board->m_ids.reserve(previous + added.size());
+        board->m_sequences.reserve(previous + added.size());
+        auto list = [&board](uint64_t p_sequence, const shared_ptr<const Flight>& p_flight, FlightId p_id)
+        {
+            board->m_flights.push_back(p_flight);
+            board->m_ids.push_back(p_id);
+            board->m_sequences.push_back(p_sequence);
+        };
+        size_t next = 0;
+        size_t change = 0;
+        for (size_t i = 0; i < previous; ++i)
+        {
+            uint64_t sequence = current->m_sequences[i];
+            for (; next < added.size() && added[next].m_sequence < sequence; ++next)
+            {
+                list(added[next].m_sequence, added[next].m_flight, added[next].m_id);
+            }
+            if (change < replaced.size() && replaced[change].first == i)
+            {
+                if (replaced[change].second)
+                {
+                    list(sequence, replaced[change].second, current->m_ids[i]);
+                }
+                ++change;
+            }
+            else
+            {
+                list(sequence, current->m_flights[i], current->m_ids[i]);
+            }
+        }
+        for (; next < added.size(); ++next)
+        {
+            list(added[next].m_sequence, added[next].m_flight, added[next].m_id);
+        }
+
+        m_board.store(board.release());
+        if (current != nullptr)
+        {
+            util::retireObject(current);
+        }
+    }
+
+    /**
+     * \brief Leaves the publication of a mutation to a task of the library Executor.
+     *
+     * A single task is pending at a time: the mutations made until it starts
+     * are published together, so a bulk load rebuilds the board a few times
+     * rather than once per flight, and never on a reader's thread.
+     */
+    void Airport::schedulePublish()
+    {
+        if (!m_publishScheduled.exchange(true))
+        {
+            m_publications.fork([this]
+            {
+                // Cleared first: a mutation counted after the board is built schedules another task
+                m_publishScheduled = false;
+                publish();
+            });
+        }
+    }
+
+    /**
+     * \brief Returns the index of the shard holding a flight number.
+     *
+     * \param[in] p_key The flight number packed by util::parseNumber.
+     * \return The shard index; the multiplicative hash spreads the numbers
+     *         that only differ by their digits.
+     */
+    size_t Airport::shardIndex(uint32_t p_key)
+    {
+        return (p_key * 0x9E3779B9u) >> 28;
+    }
+
+    Airport::Shard& Airport::shardOf(uint32_t p_key)
+    {
+        return m_shards[shardIndex(p_key)];
+    }
+
+    const Airport::Shard& Airport::shardOf(uint32_t p_key) const
+    {
+        return m_shards[shardIndex(p_key)];
+    }
+
+    Airport::Shard::Shard(pmr::memory_resource* p_resource)
+        : m_index(p_resource), m_slots(p_resource), m_entries(p_resource), m_freeSlots(p_resource),
+          m_tombstones(0), m_compactionScheduled(false)
+    {
+    }
+
+    /**
+     * \brief Looks up the live entry of a packed flight number.
+     * \return The entry, or nullptr if no flight has this number.
+     */
+    Airport::FlightEntry* Airport::Shard::find(uint32_t p_key)
+    {
+        auto found = m_index.find(p_key);
+        return found == m_index.end() ? nullptr : &m_entries[m_slots[found->second].m_entry];
+    }
+
+    const Airport::FlightEntry* Airport::Shard::find(uint32_t p_key) const
+    {
+        return const_cast<Shard&>(*this).find(p_key);
+    }
+
+    /**
+     * \brief Looks up the entry designated by a slot and its generation.
+     * \return The entry, or nullptr if the slot does not exist or was reused since.
+     */
+    Airport::FlightEntry* Airport::Shard::find(uint32_t p_slot, uint32_t p_generation)
+    {
+        if (p_slot >= m_slots.size() || m_slots[p_slot].m_generation != p_generation
+            || m_slots[p_slot].m_entry == NO_ENTRY)
+        {
+            return nullptr;
+        }
+        return &m_entries[m_slots[p_slot].m_entry];
+    }
+
+    const Airport::FlightEntry* Airport::Shard::find(uint32_t p_slot, uint32_t p_generation) const
+    {
+        return const_cast<Shard&>(*this).find(p_slot, p_generation);
+    }
+
+    /**
+     * \brief Appends a flight to the shard, in a free slot if there is one.
+     *
+     * \param[out] p_slot The slot given to the flight.
+     * \return false, leaving the shard unchanged, if the number is already listed.
+     */
+    bool Airport::Shard::insert(uint32_t p_key, uint64_t p_sequence, shared_ptr<const Flight> p_flight,
+                                uint32_t& p_slot)
+    {
+        auto inserted = m_index.try_emplace(p_key, 0);
+        if (!inserted.second)
+        {
+            return false;
+        }
+        if (m_freeSlots.empty())
+        {
+            p_slot = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back(Slot{1, NO_ENTRY});
+        }
+        else
+        {
+            p_slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        inserted.first->second = p_slot;
+        m_slots[p_slot].m_entry = static_cast<uint32_t>(m_entries.size());
+        m_entries.push_back(FlightEntry{p_sequence, move(p_flight), p_key, p_slot});
+        m_changes.push_back(Change{ChangeKind::Added, p_slot, m_slots[p_slot].m_generation, p_sequence,
+                                   m_entries.back().m_flight});
+        return true;
+    }
+
+    /**
+     * \brief Replaces the flight of an entry by a new version of it.
+     */
+    void Airport::Shard::replace(FlightEntry& p_entry, shared_ptr<const Flight> p_flight)
+    {
+        m_changes.push_back(Change{ChangeKind::Replaced, p_entry.m_slot, m_slots[p_entry.m_slot].m_generation,
+                                   p_entry.m_sequence, p_flight});
+        p_entry.m_flight = move(p_flight);
+    }
+
+    /**
+     * \brief Removes a flight, leaving a tombstone unless its entry is the last one.
+     *
+     * The generation of the slot moves on, so the handles of the flight
+     * designate nothing anymore, even once the slot is reused.
+     */
+    void Airport::Shard::erase(FlightEntry& p_entry)
+    {
+        Slot& slot = m_slots[p_entry.m_slot];
+        m_changes.push_back(Change{ChangeKind::Deleted, p_entry.m_slot, slot.m_generation, p_entry.m_sequence, nullptr});
+        slot.m_generation = slot.m_generation + 1 == 0 ? 1 : slot.m_generation + 1;
+        slot.m_entry = NO_ENTRY;
+        m_freeSlots.push_back(p_entry.m_slot);
+        m_index.erase(p_entry.m_key);
+        if (&p_entry == &m_entries.back())
+        {
+            m_entries.pop_back();
+        }
+        else
+        {
+            p_entry.m_flight.reset();
+            ++m_tombstones;
+        }
+    }
+
+    /**
+     * \brief Removes all the flights; their handles designate nothing anymore.
+     */
+    void Airport::Shard::clear()
+    {
+        logEntries(ChangeKind::Deleted);
+        for (FlightEntry& entry : m_entries)
+        {
+            if (entry.m_flight)
+            {
+                Slot& slot = m_slots[entry.m_slot];
+                slot.m_generation = slot.m_generation + 1 == 0 ? 1 : slot.m_generation + 1;
+                slot.m_entry = NO_ENTRY;
+                m_freeSlots.push_back(entry.m_slot);
+            }
+        }
+        m_index.clear();
+        m_entries.clear();
+        m_tombstones = 0;
+    }
+
+    /**
+     * \brief Logs every flight of the shard as added to the board or deleted from it.
+     *
+     * \param[in] p_kind ChangeKind::Added or ChangeKind::Deleted.
+     */
+    void Airport::Shard::logEntries(ChangeKind p_kind)
+    {
+        for (const FlightEntry& entry : m_entries)
+        {
+            if (entry.m_flight)
+            {
+                m_changes.push_back(Change{p_kind, entry.m_slot, m_slots[entry.m_slot].m_generation, entry.m_sequence,
+                                           p_kind == ChangeKind::Added ? entry.m_flight : nullptr});
+            }
+        }
+    }
+
+    /**
+     * \brief Removes the tombstones, keeping the insertion order of the entries.
+     */
+    void Airport::Shard::compact()
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_entries.size(); ++i)
+        {
+            if (m_entries[i].m_flight)
+            {
+                if (kept != i)
+                {
+                    m_entries[kept] = move(m_entries[i]);
+                }
+                m_slots[m_entries[kept].m_slot].m_entry = static_cast<uint32_t>(kept);
+                ++kept;
+            }
+        }
+        m_entries.resize(kept);
+        m_tombstones = 0;
+        m_compactionScheduled = false;
+    }
+
+    /**
+     * \brief Returns true if the tombstones exceed a quarter of the entries and
+     *        no compaction of the shard is pending.
+     */
+    bool Airport::Shard::needsCompaction() const
+    {
+        return !m_compactionScheduled && m_tombstones >= MIN_COMPACTION_TOMBSTONES
+               && m_tombstones * 4 > m_entries.size();
+    }
+
+    /**
+     * \brief Builds the shards, their indexes allocating from p_resource.
+     */
+    array<Airport::Shard, Airport::SHARD_COUNT> Airport::makeShards(pmr::memory_resource* p_resource)
+    {
+        return filledArray<Shard>(p_resource, make_index_sequence<SHARD_COUNT>());
     }
 }
 
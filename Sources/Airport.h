@@ -7,33 +7,274 @@
 #ifndef AIRPORT_H
 #define AIRPORT_H
 
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include "Flight.h"
+#include "Arrival.h"
+#include "Executor.h"
+#include "sharedMutex.h"
+#include "epochReclamation.h"
 
 
 namespace aerien{
+    /**
+     * \enum FlightResult
+     * \brief Outcome of a non-throwing flight mutation of an Airport.
+     */
+    enum class FlightResult
+    {
+      Ok,             ///< The mutation was applied.
+      AlreadyExists,  ///< A flight with the same number is already listed.
+      Absent,         ///< No flight has the requested number.
+      InvalidNumber,  ///< The requested flight number is not a valid number.
+      NotArrival,     ///< The flight exists but is not an arrival.
+      InvalidStatus   ///< The requested status is not a valid arrival status.
+    };
+
+    /**
+     * \struct StatusUpdate
+     * \brief Compact status change of an arrival, as carried by the status feeds.
+     */
+    struct StatusUpdate
+    {
+      std::uint32_t m_number;   ///< Flight number packed by util::parseNumber.
+      ArrivalStatus m_status;
+    };
+
+    /**
+     * \struct FlightId
+     * \brief Stable handle of a flight listed by an Airport.
+     *
+     * A handle reaches its flight without parsing nor hashing its number. It
+     * stays valid until the flight is deleted, across the other insertions
+     * and deletions; a handle of a deleted flight never designates another
+     * one. Handles are only meaningful to the airport that gave them.
+     */
+    struct FlightId
+    {
+      std::uint32_t m_slot = 0;        ///< Shard in the low bits, slot of the shard above.
+      std::uint32_t m_generation = 0;  ///< Generation of the slot; 0 for no flight.
+
+      bool isNull() const { return m_generation == 0; }
+      bool operator== (const FlightId& p_id) const = default;
+    };
+
     /**
      * \class Airport
      * \brief Class representing an airport with its associated flights.
+     *
+     * All the public methods can be called concurrently. The flights are spread
+     * over SHARD_COUNT shards by a hash of their packed number, each shard with
+     * its own lock and index, so operations on different flights rarely wait
+     * for each other.
+     *
+     * Readers work on an immutable Board, the flights in insertion order,
+     * published through an atomic pointer. A Snapshot of the current board is
+     * taken without any lock, so a slow renderer never delays a writer. A
+     * mutation only counts itself in the version and leaves the new board to
+     * a task of the library Executor, which publishes the mutations made
+     * meanwhile together. A snapshot taken while a mutation is not published
+     * yet publishes it first, so a thread always reads its own completed
+     * mutations. Each shard logs its mutations until they are published: a
+     * publication takes the logs, holding each shard lock only for that, and
+     * derives the new board from the previous one, sorting only the added
+     * flights. The replaced boards are deleted by the epoch-based
+     * reclamation once no snapshot can see them.
+     *
+     * Each shard keeps its flights in a slot map: FlightId handles designate
+     * slots, deleting a flight leaves a tombstone in the shard's entries, and
+     * the tombstones are compacted by a task of the library Executor once
+     * they exceed a quarter of the entries.
+     *
+     * The public methods record their calls, failures and latencies in the
+     * metrics of metrics.h when they are enabled; a call of a try method
+     * fails when it returns something else than FlightResult::Ok, so the
+     * failures of addFlight and deleteFlight are the times they throw.
+     *
+     * The copies of the flights, their strings and the shard indexes are
+     * allocated from the memory resource given at construction, the default
+     * resource otherwise. The resource is used by several threads at once
+     * and must be thread-safe (util::ArenaResource,
+     * std::pmr::synchronized_pool_resource); it must outlive the airport and
+     * the snapshots taken of it.
      */
     class Airport
     {
     public:
-      Airport (const std::string& p_code);
+      /**
+       * \struct Board
+       * \brief Immutable version of the airport published for the readers.
+       */
+      struct Board
+      {
+        std::string m_code;
+        std::vector<std::shared_ptr<const Flight>> m_flights; ///< In insertion order.
+        std::vector<FlightId> m_ids;                          ///< Handle of each flight of m_flights.
+        std::vector<std::uint64_t> m_sequences;               ///< Rank of each flight in the insertion order.
+        std::uint64_t m_version;
+      };
+
+      /**
+       * \class Snapshot
+       * \brief Lock-free reference to the board published when it was taken.
+       *
+       * The board stays valid while the snapshot lives; a snapshot must stay
+       * on the thread that took it.
+       */
+      class Snapshot
+      {
+      public:
+        explicit Snapshot (const Airport& p_airport);
+        const Board& operator* () const { return *m_board; }
+        const Board* operator-> () const { return m_board; }
+
+      private:
+        util::EpochGuard m_guard;
+        const Board* m_board;
+      };
+
+      Airport (const std::string& p_code,
+               std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
+      Airport (const util::Code& p_code,
+               std::pmr::memory_resource* p_resource = std::pmr::get_default_resource());
       Airport (const Airport& p_airport);
+      Airport (const Airport& p_airport, std::pmr::memory_resource* p_resource);
+      Airport (Airport&& p_airport);
       const Airport& operator= (const Airport& p_airport);
-      const std::string & getCode()const;
+      Airport& operator= (Airport&& p_airport);
+      virtual ~Airport ();
+      std::string getCode()const;
+      std::pmr::memory_resource* getMemoryResource()const;
       void addFlight(const Flight& p_flight);
       
       void deleteFlight (const std::string& p_number); 
+      FlightResult tryAddFlight(const Flight& p_flight, FlightId* p_id = nullptr);
+      std::vector<FlightResult> tryAddFlights(const std::vector<const Flight*>& p_flights);
+      FlightResult tryDeleteFlight(const std::string& p_number);
+      FlightResult tryDeleteFlight(FlightId p_id);
+      FlightResult setFlightStatus(const std::string& p_number, const std::string& p_status);
+      FlightResult setFlightStatus(FlightId p_id, const std::string& p_status);
+      std::size_t applyStatusUpdates(const StatusUpdate* p_updates, std::size_t p_count);
+      std::unique_ptr<Flight> getFlight(const std::string& p_number) const;
+      std::shared_ptr<const Flight> getFlight(FlightId p_id) const;
+      FlightId findFlight(const std::string& p_number) const;
+      std::size_t getFlightCount() const;
+      Snapshot getSnapshot() const;
+      MemoryUsage memoryUsage() const;
       
       virtual std::string getAirportFormatted()const;
+      static std::string formatBoard(const Board& p_board, std::size_t p_threads = 0);
+      static void writeBoard(std::ostream& p_os, const Board& p_board);
+
+      static const std::size_t SHARD_COUNT = 16;
+      static const std::size_t PARALLEL_RENDER_ROWS = 4096;
+      static const std::size_t MIN_COMPACTION_TOMBSTONES = 64;
 
     private:
+      /**
+       * \struct FlightEntry
+       * \brief A flight with its rank in the insertion order; a tombstone once its flight is null.
+       */
+      struct FlightEntry
+      {
+        std::uint64_t m_sequence;
+        std::shared_ptr<const Flight> m_flight;
+        std::uint32_t m_key;   ///< Flight number packed by util::parseNumber.
+        std::uint32_t m_slot;  ///< Slot designating the entry.
+      };
+
+      /**
+       * \enum ChangeKind
+       * \brief Kind of a mutation logged by a shard for the next publication.
+       */
+      enum class ChangeKind
+      {
+        Added,
+        Replaced,
+        Deleted
+      };
+
+      /**
+       * \struct Change
+       * \brief Mutation of a flight of a shard, not published yet.
+       */
+      struct Change
+      {
+        ChangeKind m_kind;
+        std::uint32_t m_slot;
+        std::uint32_t m_generation;              ///< Generation of the slot while it designated the flight.
+        std::uint64_t m_sequence;                ///< Rank of an added flight in the insertion order.
+        std::shared_ptr<const Flight> m_flight;  ///< The added flight or its new version; null for a deletion.
+      };
+
+      /**
+       * \struct Slot
+       * \brief Stable position of a flight, designated by the FlightIds.
+       */
+      struct Slot
+      {
+        std::uint32_t m_generation;  ///< Incremented when the flight of the slot is deleted.
+        std::uint32_t m_entry;       ///< Index of the entry, NO_ENTRY while the slot is free.
+      };
+
+      /**
+       * \struct Shard
+       * \brief Slot map of the flights whose numbers hash to the same shard, indexed by packed number.
+       */
+      struct alignas(64) Shard
+      {
+        explicit Shard (std::pmr::memory_resource* p_resource);
+        FlightEntry* find (std::uint32_t p_key);
+        FlightEntry* find (std::uint32_t p_slot, std::uint32_t p_generation);
+        const FlightEntry* find (std::uint32_t p_key) const;
+        const FlightEntry* find (std::uint32_t p_slot, std::uint32_t p_generation) const;
+        bool insert (std::uint32_t p_key, std::uint64_t p_sequence, std::shared_ptr<const Flight> p_flight,
+                     std::uint32_t& p_slot);
+        void replace (FlightEntry& p_entry, std::shared_ptr<const Flight> p_flight);
+        void erase (FlightEntry& p_entry);
+        void clear ();
+        void logEntries (ChangeKind p_kind);
+        void compact ();
+        bool needsCompaction () const;
+
+        mutable util::SharedMutex m_mutex;
+        std::pmr::unordered_map<std::uint32_t, std::uint32_t> m_index;  ///< Packed number to slot.
+        std::pmr::vector<Slot> m_slots;
+        std::pmr::vector<FlightEntry> m_entries;  ///< Live entries and tombstones, in insertion order.
+        std::pmr::vector<std::uint32_t> m_freeSlots;
+        mutable std::vector<Change> m_changes;  ///< Mutations since the last publication, which takes them.
+        std::size_t m_tombstones;
+        bool m_compactionScheduled;
+      };
+
       void verifieInvariant() const;
-      std::string m_code;
-      std::vector<std::unique_ptr<Flight>> m_flights;
+      void publish() const;
+      void schedulePublish();
+      void takeFlights(Airport& p_source);
+      FlightResult updateEntry(Shard& p_shard, FlightEntry* p_entry, const std::string& p_status);
+      FlightResult updateStatus(std::uint32_t p_key, const std::string& p_status);
+      FlightResult deleteEntry(std::size_t p_shard, FlightEntry* p_entry);
+      static std::size_t shardIndex(std::uint32_t p_key);
+      Shard& shardOf(std::uint32_t p_key);
+      const Shard& shardOf(std::uint32_t p_key) const;
+      static std::array<Shard, SHARD_COUNT> makeShards(std::pmr::memory_resource* p_resource);
+      std::string m_code;  ///< Guarded by the lock of the first shard.
+      std::pmr::memory_resource* m_resource;
+      std::array<Shard, SHARD_COUNT> m_shards;
+      std::atomic<std::uint64_t> m_nextSequence;
+      std::atomic<std::uint64_t> m_version;
+      mutable std::atomic<const Board*> m_board;
+      mutable std::mutex m_publishMutex;
+      std::atomic<bool> m_publishScheduled;  ///< A publication task is pending.
+      Executor::TaskGroup m_publications;
+      Executor::TaskGroup m_compactions;  ///< Declared last: joined before the shards are destroyed.
   
     };
       
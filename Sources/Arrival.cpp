@@ -9,10 +9,47 @@
 #include "Flight.h"
 #include "ContratException.h"
 #include "validationFormat.h"
+#include "trace.h"
 #include <sstream>
 namespace aerien{
     using namespace std;
 
+    namespace
+    {
+      const string STATUS_TEXTS[] = {" Atterri ", " Retardé ", "À l'heure"};
+    }
+
+    /**
+     * \brief Returns the text of a status, as shown on the board.
+     *
+     * \param[in] p_status The compact status.
+     * \return The status string accepted by isValidStatus.
+     */
+    const string& statusText (ArrivalStatus p_status)
+    {
+      return STATUS_TEXTS[static_cast<int>(p_status)];
+    }
+
+    /**
+     * \brief Converts a status string to its compact form.
+     *
+     * \param[in] p_text The status string.
+     * \param[out] p_status The compact status, when the text is valid.
+     * \return true if p_text is one of the valid statuses.
+     */
+    bool parseStatus (string_view p_text, ArrivalStatus& p_status)
+    {
+      for (int i = 0; i < 3; ++i)
+        {
+          if (p_text == STATUS_TEXTS[i])
+            {
+              p_status = static_cast<ArrivalStatus>(i);
+              return true;
+            }
+        }
+      return false;
+    }
+
     
     /**
      * \brief Constructor of the Arrival class with status validation.
@@ -24,39 +61,69 @@ namespace aerien{
      * \param[in] p_status The status of the arrival.
      * \pre isValidStatus(p_status) must return true.
      * \post m_status is set to p_status.
+     * \throws FlightException if p_status is not a status, or a field is longer than it can hold.
      */
     Arrival::Arrival (const std::string & p_number, const std::string & p_company,
              const std::string & p_hour, const std::string & p_city, const std::string& p_status):
-                        Flight(p_number, p_company, p_hour, p_city),m_status(p_status)
+                        Flight(p_number, p_company, p_hour, p_city), m_status(ArrivalStatus::OnTime)
     {
+      TRACE_SPAN("Arrival validation");
       PRECONDITION(util::isValidStatus (p_status) );
-      POSTCONDITION(m_status == p_status);
+      if (!parseStatus(p_status, m_status))
+        {
+          throw FlightException("Invalid status :\n" + p_status);
+        }
+      POSTCONDITION(getStatus() == p_status);
       INVARIANTS ();
     }
 
+    /**
+     * \brief Constructor of the Arrival class from compile-time validated fields.
+     *
+     * The status was checked when its literal was compiled, so the invariant
+     * is not evaluated again.
+     *
+     * \param[in] p_number The flight number.
+     * \param[in] p_company The airline company.
+     * \param[in] p_hour The flight hour.
+     * \param[in] p_city The city of origin or destination.
+     * \param[in] p_status The status of the arrival.
+     */
+    Arrival::Arrival (const util::FlightNumber & p_number, const util::Name & p_company,
+             const util::Hour & p_hour, const util::Name & p_city, const util::Status & p_status):
+                        Flight(p_number, p_company, p_hour, p_city), m_status(ArrivalStatus::OnTime)
+    {
+      parseStatus(p_status.value(), m_status);
+    }
+
+
      /**
      * \brief Sets the status of the arrival.
      *
      * \param[in] p_status The new status of the arrival.
      * \pre isValidStatus(p_status) must return true.
      * \post m_status is set to p_status.
+     * \throws FlightException if p_status is not a status; the arrival keeps its status.
      */
     void Arrival::setStatus(const std::string& p_status)
     {
         PRECONDITION(util::isValidStatus (p_status));
-        m_status = p_status;
-        POSTCONDITION(m_status == p_status);
+        if (!parseStatus(p_status, m_status))
+          {
+            throw FlightException("Invalid status :\n" + p_status);
+          }
+        POSTCONDITION(getStatus() == p_status);
         INVARIANTS ();
     }
 
 
      /**
      * \brief Gets the status of the arrival.
-     * \return A constant reference to the status string.
+     * \return The text of the status.
      */
     const string& Arrival::getStatus()const
     {
-        return m_status;
+        return statusText(m_status);
     }
 
 
@@ -71,7 +138,7 @@ namespace aerien{
     string Arrival::getFlightFormatted()const
     {
         ostringstream os;
-        os << Flight::getFlightFormatted()<<m_status<<"|";
+        os << Flight::getFlightFormatted()<<statusText(m_status)<<"|";
         return os.str(); 
     }
     
@@ -85,8 +152,33 @@ namespace aerien{
      */
     unique_ptr<Flight> Arrival::clone ()const
     {
+        TRACE_SPAN("Arrival::clone");
         return make_unique <Arrival> (*this); 
     }
+
+    /**
+     * \brief Copies the arrival and its control block into a memory resource.
+     *
+     * \param[in] p_resource The memory resource of the copy.
+     * \return A shared pointer to the copy.
+     */
+    shared_ptr<Flight> Arrival::share (pmr::memory_resource* p_resource) const
+    {
+        TRACE_SPAN("Arrival::share");
+        return allocate_shared<Arrival>(pmr::polymorphic_allocator<Arrival>(p_resource), *this);
+    }
+
+    /**
+     * \brief Adds the Arrival object, its fields included, to a memory breakdown.
+     *
+     * \param[in,out] p_usage The breakdown to complete.
+     */
+    void Arrival::addMemoryUsage (MemoryUsage& p_usage) const
+    {
+        p_usage.m_objects += sizeof(Arrival);
+        p_usage.addAllocation(sizeof(Arrival));
+        Flight::addMemoryUsage(p_usage);
+    }
         
     /**
      * \brief Checks the invariant of the Arrival class.
@@ -103,7 +195,7 @@ namespace aerien{
      */
     void Arrival::verifieInvariant() const
     {
-        INVARIANT(util::isValidStatus (m_status));
+        INVARIANT(util::isValidStatus (statusText(m_status)));
     }
 
  
@@ -7,29 +7,49 @@
 #include "Flight.h"
 #ifndef ARRIVAL_H
 #define ARRIVAL_H
+#include <cstdint>
 namespace aerien
 {
+  /**
+   * \enum ArrivalStatus
+   * \brief Compact form of the three valid arrival statuses.
+   */
+  enum class ArrivalStatus : std::uint8_t
+  {
+    Landed,   ///< " Atterri "
+    Delayed,  ///< " Retardé "
+    OnTime    ///< "À l'heure"
+  };
+
+  const std::string& statusText (ArrivalStatus p_status);
+  bool parseStatus (std::string_view p_text, ArrivalStatus& p_status);
 
   /**
    * \class Arrival
    * \brief Classe représentant un vol d'arrivée, dérivée de la classe Vol.
+   *
+   * The status is kept in its compact form; getStatus() returns its text.
    */
   class Arrival : public Flight
   {
   public:
     Arrival (const std::string & p_number, const std::string & p_company,
              const std::string & p_hour, const std::string & p_city, const std::string& p_status);
+    Arrival (const util::FlightNumber & p_number, const util::Name & p_company,
+             const util::Hour & p_hour, const util::Name & p_city, const util::Status & p_status);
 
     void setStatus (const std::string& p_status);
     const std::string& getStatus ()const;
     virtual std::string getFlightFormatted ()const;
     virtual std::unique_ptr<Flight> clone ()const;
+    virtual std::shared_ptr<Flight> share (std::pmr::memory_resource* p_resource) const;
+    virtual void addMemoryUsage (MemoryUsage& p_usage) const;
 
     virtual
     ~Arrival () { };
 
   private:
-    std::string m_status;
+    ArrivalStatus m_status;
     void verifieInvariant () const;
   };
 }
@@ -0,0 +1,421 @@
+/**
+ * \file   BatchSession.cpp
+ * \brief  File containing the implementation of the BatchSession class
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "BatchSession.h"
+#include "Depart.h"
+#include "ScheduleGenerator.h"
+#include "ScheduleLoader.h"
+#include "trace.h"
+#include "validationFormat.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+namespace aerien{
+    using namespace std;
+
+    namespace
+    {
+      /**
+       * \brief Removes the leading and trailing spaces, tabs and carriage returns.
+       */
+      string_view trim (string_view p_text)
+      {
+        size_t first = p_text.find_first_not_of(" \t\r");
+        if (first == string_view::npos)
+          {
+            return string_view();
+          }
+        return p_text.substr(first, p_text.find_last_not_of(" \t\r") - first + 1);
+      }
+
+      /**
+       * \brief Removes the first word of a text and returns it.
+       */
+      string_view nextWord (string_view& p_text)
+      {
+        p_text = trim(p_text);
+        size_t end = p_text.find_first_of(" \t");
+        string_view word = p_text.substr(0, end);
+        p_text = end == string_view::npos ? string_view() : trim(p_text.substr(end));
+        return word;
+      }
+
+      /**
+       * \brief Reads a non-negative integer argument.
+       *
+       * \throws BatchError if the word is not a number.
+       */
+      uint64_t toCount (string_view p_word)
+      {
+        if (p_word.empty() || p_word.size() > 18 || p_word.find_first_not_of("0123456789") != string_view::npos)
+          {
+            throw BatchError("expected a number instead of \"" + string(p_word) + "\"");
+          }
+        uint64_t value = 0;
+        for (char digit : p_word)
+          {
+            value = value * 10 + static_cast<uint64_t>(digit - '0');
+          }
+        return value;
+      }
+
+      /**
+       * \brief Throws a BatchError if a mutation was refused by the airport.
+       */
+      void check (FlightResult p_result, string_view p_number)
+      {
+        string number(p_number);
+        switch (p_result)
+          {
+          case FlightResult::Ok:
+            return;
+          case FlightResult::AlreadyExists:
+            throw BatchError("flight " + number + " already exists");
+          case FlightResult::Absent:
+            throw BatchError("flight " + number + " does not exist");
+          case FlightResult::InvalidNumber:
+            throw BatchError("invalid flight number \"" + number + "\"");
+          case FlightResult::NotArrival:
+            throw BatchError("flight " + number + " is not an arrival");
+          case FlightResult::InvalidStatus:
+            throw BatchError("invalid status for flight " + number);
+          }
+      }
+    }
+
+    const BatchSession::Command BatchSession::COMMANDS[] = {
+      {"airport", &BatchSession::newAirport},
+      {"load", &BatchSession::load},
+      {"import", &BatchSession::import},
+      {"generate", &BatchSession::generate},
+      {"add", &BatchSession::add},
+      {"delete", &BatchSession::remove},
+      {"status", &BatchSession::status},
+      {"get", &BatchSession::get},
+      {"find", &BatchSession::find},
+      {"count", &BatchSession::count},
+      {"render", &BatchSession::render},
+      {"export", &BatchSession::exportCsv},
+      {"help", &BatchSession::help},
+    };
+
+    const size_t BatchSession::COMMAND_COUNT = size(BatchSession::COMMANDS);
+
+    /**
+     * \brief Constructor of a session on an empty airport.
+     *
+     * \param[out] p_out The stream the commands write to.
+     * \param[in] p_code The code of the airport.
+     * \pre p_code is a valid airport code.
+     */
+    BatchSession::BatchSession (ostream& p_out, const string& p_code):
+      m_out(p_out), m_airport(p_code), m_searchVersion(0)
+    {
+      for (size_t i = 0; i < COMMAND_COUNT; ++i)
+        {
+          m_stats.push_back(CommandStats{COMMANDS[i].m_name});
+        }
+    }
+
+    /**
+     * \brief Runs one command line.
+     *
+     * \param[in] p_line The command and its argument.
+     * \throws BatchError if the command is unknown, malformed or refused.
+     */
+    void BatchSession::execute (string_view p_line)
+    {
+      string_view argument = p_line;
+      string_view name = nextWord(argument);
+      if (name.empty() || name[0] == '#')
+        {
+          return;
+        }
+      for (size_t i = 0; i < COMMAND_COUNT; ++i)
+        {
+          if (name == COMMANDS[i].m_name)
+            {
+              TRACE_SPAN(COMMANDS[i].m_name);
+              auto start = chrono::steady_clock::now();
+              (this->*COMMANDS[i].m_run)(argument);
+              m_stats[i].m_nanoseconds += static_cast<uint64_t>(
+                  chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - start).count());
+              ++m_stats[i].m_calls;
+              return;
+            }
+        }
+      throw BatchError("unknown command \"" + string(name) + "\"");
+    }
+
+    /**
+     * \brief Runs the commands of a stream, one per line, up to the first error.
+     *
+     * \param[in,out] p_commands The stream of the commands.
+     * \return The number of lines read.
+     * \throws BatchError naming the line of the first command that failed.
+     */
+    size_t BatchSession::run (istream& p_commands)
+    {
+      string line;
+      size_t lines = 0;
+      while (getline(p_commands, line))
+        {
+          ++lines;
+          try
+            {
+              execute(line);
+            }
+          catch (exception& e)
+            {
+              throw BatchError("line " + to_string(lines) + ": " + e.what());
+            }
+        }
+      m_out.flush();
+      return lines;
+    }
+
+    /**
+     * \brief Returns the airport of the session.
+     */
+    const Airport& BatchSession::getAirport () const
+    {
+      return m_airport;
+    }
+
+    /**
+     * \brief Returns the calls and time of each command, in the order of usage().
+     */
+    const vector<CommandStats>& BatchSession::getStats () const
+    {
+      return m_stats;
+    }
+
+    /**
+     * \brief Formats the time spent by each command used and the memory of the airport.
+     */
+    string BatchSession::statsReport () const
+    {
+      string report = "command      calls   total(ms)    mean(us)\n";
+      char line[96];
+      for (const CommandStats& stats : m_stats)
+        {
+          if (stats.m_calls == 0)
+            {
+              continue;
+            }
+          snprintf(line, sizeof(line), "%-10s %7zu %11.3f %11.3f\n", stats.m_name, stats.m_calls,
+                   stats.m_nanoseconds / 1e6, stats.m_nanoseconds / 1e3 / stats.m_calls);
+          report += line;
+        }
+      report += "\nmemory of airport " + m_airport.getCode() + "\n";
+      report += m_airport.memoryUsage().report();
+      return report;
+    }
+
+    /**
+     * \brief Returns the list of the commands.
+     */
+    const char* BatchSession::usage ()
+    {
+      return "airport CODE           start an empty airport\n"
+             "load FILE              replace the flights by a CSV schedule\n"
+             "import FILE            add the flights of a CSV schedule\n"
+             "generate COUNT [SEED]  add COUNT generated flights\n"
+             "add ROW                add a flight given as a CSV row\n"
+             "delete NUMBER          delete a flight\n"
+             "status NUMBER STATUS   change the status of an arrival\n"
+             "get NUMBER             print a flight\n"
+             "find QUERY             print the flights matching a number prefix,\n"
+             "                       a word of a company or city, or a gate\n"
+             "count                  print the number of flights\n"
+             "render                 print the board\n"
+             "export FILE            write the flights as a CSV schedule, - for the output\n"
+             "help                   print this list\n";
+    }
+
+    /**
+     * \brief Command "airport CODE": replaces the airport by an empty one.
+     */
+    void BatchSession::newAirport (string_view p_argument)
+    {
+      string code(nextWord(p_argument));
+      if (!util::isValideCode(code))
+        {
+          throw BatchError("invalid airport code \"" + code + "\"");
+        }
+      m_airport = Airport(code);
+      m_searchVersion = 0;
+    }
+
+    /**
+     * \brief Command "load FILE": replaces the flights by those of a CSV schedule.
+     */
+    void BatchSession::load (string_view p_argument)
+    {
+      Airport loaded(m_airport.getCode());
+      loadInto(p_argument, loaded);
+      m_airport = move(loaded);
+      m_searchVersion = 0;
+    }
+
+    /**
+     * \brief Command "import FILE": adds the flights of a CSV schedule.
+     */
+    void BatchSession::import (string_view p_argument)
+    {
+      loadInto(p_argument, m_airport);
+    }
+
+    /**
+     * \brief Command "generate COUNT [SEED]": adds generated flights.
+     */
+    void BatchSession::generate (string_view p_argument)
+    {
+      uint64_t count = toCount(nextWord(p_argument));
+      string_view seed = nextWord(p_argument);
+      if (count > ScheduleGenerator::MAX_FLIGHTS)
+        {
+          throw BatchError("at most " + to_string(ScheduleGenerator::MAX_FLIGHTS) + " flights can be generated");
+        }
+      size_t added = ScheduleGenerator(seed.empty() ? 1 : toCount(seed)).fill(m_airport, count);
+      m_out << added << " flights added\n";
+    }
+
+    /**
+     * \brief Command "add ROW": adds a flight given as a row of a CSV schedule.
+     */
+    void BatchSession::add (string_view p_argument)
+    {
+      unique_ptr<Flight> flight = ScheduleLoader::parseRow(trim(p_argument));
+      if (!flight)
+        {
+          throw BatchError("invalid flight \"" + string(trim(p_argument)) + "\"");
+        }
+      check(m_airport.tryAddFlight(*flight), flight->getNumberView());
+    }
+
+    /**
+     * \brief Command "delete NUMBER": deletes a flight.
+     */
+    void BatchSession::remove (string_view p_argument)
+    {
+      string_view number = nextWord(p_argument);
+      check(m_airport.tryDeleteFlight(string(number)), number);
+    }
+
+    /**
+     * \brief Command "status NUMBER STATUS": changes the status of an arrival.
+     *
+     * The status may be typed without the spaces that pad it on the board,
+     * "Retardé" for " Retardé ".
+     */
+    void BatchSession::status (string_view p_argument)
+    {
+      string_view number = nextWord(p_argument);
+      string status(p_argument);
+      if (!util::isValidStatus(status))
+        {
+          status = " " + status + " ";
+        }
+      check(m_airport.setFlightStatus(string(number), status), number);
+    }
+
+    /**
+     * \brief Command "get NUMBER": prints the row of a flight.
+     */
+    void BatchSession::get (string_view p_argument)
+    {
+      string number(nextWord(p_argument));
+      FlightId id = m_airport.findFlight(number);
+      if (id.isNull())
+        {
+          throw BatchError("flight " + number + " does not exist");
+        }
+      m_out << m_airport.getFlight(id)->getFlightFormatted() << '\n';
+    }
+
+    /**
+     * \brief Command "find QUERY": prints the rows of the matching flights.
+     *
+     * The index is built on the first search of a board and kept while the
+     * airport does not change.
+     */
+    void BatchSession::find (string_view p_argument)
+    {
+      Airport::Snapshot board = m_airport.getSnapshot();
+      if (m_searchVersion != board->m_version)
+        {
+          m_searchIndex = FlightSearchIndex(board->m_flights);
+          m_searchVersion = board->m_version;
+        }
+      for (size_t position : m_searchIndex.search(p_argument))
+        {
+          m_out << board->m_flights[position]->getFlightFormatted() << '\n';
+        }
+    }
+
+    /**
+     * \brief Command "count": prints the number of flights.
+     */
+    void BatchSession::count (string_view)
+    {
+      m_out << m_airport.getFlightCount() << '\n';
+    }
+
+    /**
+     * \brief Command "render": prints the board.
+     */
+    void BatchSession::render (string_view)
+    {
+      Airport::writeBoard(m_out, *m_airport.getSnapshot());
+    }
+
+    /**
+     * \brief Command "export FILE": writes the flights as a CSV schedule.
+     */
+    void BatchSession::exportCsv (string_view p_argument)
+    {
+      string path(trim(p_argument));
+      if (path.empty() || path == "-")
+        {
+          ScheduleLoader::writeCsv(m_out, *m_airport.getSnapshot());
+          return;
+        }
+      ofstream file(path, ios::binary);
+      ScheduleLoader::writeCsv(file, *m_airport.getSnapshot());
+      if (!file.flush())
+        {
+          throw BatchError("cannot write " + path);
+        }
+    }
+
+    /**
+     * \brief Command "help": prints the list of the commands.
+     */
+    void BatchSession::help (string_view)
+    {
+      m_out << usage();
+    }
+
+    /**
+     * \brief Loads a CSV schedule into an airport and prints the counts of its rows.
+     */
+    void BatchSession::loadInto (string_view p_path, Airport& p_airport)
+    {
+      string path(trim(p_path));
+      ifstream file(path, ios::binary);
+      if (!file)
+        {
+          throw BatchError("cannot open " + path);
+        }
+      LoadReport report = ScheduleLoader().loadCsv(file, p_airport);
+      m_out << report.m_rows << " rows, " << report.m_added << " added, " << report.m_duplicates
+            << " duplicates, " << report.m_invalid << " invalid\n";
+    }
+}
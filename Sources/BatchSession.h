@@ -0,0 +1,105 @@
+/**
+ \file BatchSession.h
+ \brief File containing the declaration of the BatchSession class
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef BATCHSESSION_H
+#define BATCHSESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Airport.h"
+#include "FlightSearchIndex.h"
+
+namespace aerien
+{
+  /**
+   * \class BatchError
+   * \brief Error of a batch command: unknown, malformed, or refused by the airport.
+   */
+  class BatchError : public std::runtime_error
+  {
+  public:
+    explicit BatchError (const std::string& p_reason) : std::runtime_error(p_reason) {}
+  };
+
+  /**
+   * \struct CommandStats
+   * \brief Calls and time spent by one command of a batch.
+   */
+  struct CommandStats
+  {
+    const char* m_name;
+    std::size_t m_calls = 0;
+    std::uint64_t m_nanoseconds = 0;
+  };
+
+  /**
+   * \class BatchSession
+   * \brief Runs batch commands, one per line, against an airport.
+   *
+   * The commands load, import, query, mutate, render and export the airport
+   * (see usage()). Their output is written to the stream of the session as
+   * it is produced: the board and the exports are streamed by blocks, never
+   * built whole. A blank line or a line starting with '#' is skipped.
+   */
+  class BatchSession
+  {
+  public:
+    explicit BatchSession (std::ostream& p_out, const std::string& p_code = "YUL");
+
+    void execute (std::string_view p_line);
+    std::size_t run (std::istream& p_commands);
+
+    const Airport& getAirport () const;
+    const std::vector<CommandStats>& getStats () const;
+    std::string statsReport () const;
+
+    static const char* usage ();
+
+  private:
+    /**
+     * \struct Command
+     * \brief A command of the batch and the member running it.
+     */
+    struct Command
+    {
+      const char* m_name;
+      void (BatchSession::*m_run) (std::string_view p_argument);
+    };
+
+    static const Command COMMANDS[];
+    static const std::size_t COMMAND_COUNT;
+
+    void newAirport (std::string_view p_argument);
+    void load (std::string_view p_argument);
+    void import (std::string_view p_argument);
+    void generate (std::string_view p_argument);
+    void add (std::string_view p_argument);
+    void remove (std::string_view p_argument);
+    void status (std::string_view p_argument);
+    void get (std::string_view p_argument);
+    void find (std::string_view p_argument);
+    void count (std::string_view p_argument);
+    void render (std::string_view p_argument);
+    void exportCsv (std::string_view p_argument);
+    void help (std::string_view p_argument);
+
+    void loadInto (std::string_view p_path, Airport& p_airport);
+
+    std::ostream& m_out;
+    Airport m_airport;
+    FlightSearchIndex m_searchIndex;
+    std::uint64_t m_searchVersion;        ///< Version of the board m_searchIndex was built from; 0 for none.
+    std::vector<CommandStats> m_stats;    ///< One per command, in the order of usage().
+  };
+}
+
+#endif /* BATCHSESSION_H */
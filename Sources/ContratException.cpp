@@ -96,4 +96,56 @@ InvariantException::InvariantException(std::string p_file, unsigned int p_line,
                                        std::string p_expr)
     : ContratException(p_file, p_line, p_expr, "INVARIANT ERROR")
 {
-}
\ No newline at end of file
+}
+
+std::atomic<ContractSite*> ContractSite::s_head {nullptr};
+
+/**
+ * \brief Constructor for a contract site, registering it in the list of sites
+ *
+ * \param p_kind Kind of the check (PRECONDITION, INVARIANT, ...)
+ * \param p_file String representing the source file of the check
+ * \param p_line Integer representing the line of the check
+ * \param p_expr Logical test of the check
+ */
+ContractSite::ContractSite(const char* p_kind, const char* p_file, unsigned int p_line,
+                           const char* p_expr)
+    : m_kind(p_kind), m_file(p_file), m_line(p_line), m_expression(p_expr), m_violations(0),
+      m_next(s_head.load(std::memory_order_relaxed))
+{
+    while (!s_head.compare_exchange_weak(m_next, this, std::memory_order_release,
+                                         std::memory_order_relaxed))
+        ;
+}
+
+/**
+ * \brief Counts one more failure of the check
+ */
+void ContractSite::recordViolation()
+{
+    m_violations.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Returns the number of failures of the check
+ * \return The number of violations recorded so far
+ */
+unsigned long ContractSite::reqViolations() const
+{
+    return m_violations.load(std::memory_order_relaxed);
+}
+
+/**
+ * \brief Lists every check that has failed at least once
+ * \return One report per site, most recently registered first
+ */
+std::vector<ContractSite::Report> ContractSite::reqSites()
+{
+    std::vector<Report> sites;
+    for (const ContractSite* site = s_head.load(std::memory_order_acquire); site; site = site->m_next)
+    {
+        sites.push_back({site->m_kind, site->m_file, site->m_line, site->m_expression,
+                         site->reqViolations()});
+    }
+    return sites;
+}
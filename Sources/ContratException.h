@@ -9,6 +9,8 @@
 
 #include <string>
 #include <stdexcept>
+#include <atomic>
+#include <vector>
 
 /**
  * \class ContratException
@@ -66,31 +68,118 @@ public:
     InvariantException(std::string, unsigned int, std::string);
 };
 
+/**
+ * \class ContractSite
+ * \brief Violation counter of one contract check of the source code.
+ *
+ * A site is created the first time its check fails and stays registered
+ * for the whole run, so the failing checks can be listed at any time.
+ */
+class ContractSite
+{
+public:
+    /**
+     * \struct Report
+     * \brief Copy of the state of a site at the time of the call.
+     */
+    struct Report
+    {
+        std::string m_kind;
+        std::string m_file;
+        unsigned int m_line;
+        std::string m_expression;
+        unsigned long m_violations;
+    };
+
+    ContractSite(const char* p_kind, const char* p_file, unsigned int p_line, const char* p_expr);
+    ContractSite(const ContractSite&) = delete;
+    ContractSite& operator=(const ContractSite&) = delete;
+
+    void recordViolation();
+    unsigned long reqViolations() const;
+    static std::vector<Report> reqSites();
+
+private:
+    const char* m_kind;
+    const char* m_file;
+    unsigned int m_line;
+    const char* m_expression;
+    std::atomic<unsigned long> m_violations;
+    ContractSite* m_next;
+
+    static std::atomic<ContractSite*> s_head;
+};
+
 // --- Definition of macros for contract theory control
+//
+// CONTRACT_LEVEL selects the checks compiled in:
+//   0  none
+//   1  PRECONDITION
+//   2  PRECONDITION on every call; POSTCONDITION, ASSERTION and INVARIANTS()
+//      once every CONTRACT_SAMPLE_RATE calls of each site and thread. The
+//      INVARIANT checks run whenever their INVARIANTS() call is sampled.
+//   3  everything on every call
+// Without an explicit level, debug builds use 3 and NDEBUG builds use 0, as
+// before the levels existed.
 
-#if !defined(NDEBUG)
-// --- Debug mode
+#if !defined(CONTRACT_LEVEL)
+#  if !defined(NDEBUG)
+#    define CONTRACT_LEVEL 3
+#  else
+#    define CONTRACT_LEVEL 0
+#  endif
+#endif
 
-#  define INVARIANTS() \
-      verifieInvariant()
+#if !defined(CONTRACT_SAMPLE_RATE)
+#  define CONTRACT_SAMPLE_RATE 64
+#endif
 
-#  define ASSERTION(f)     \
-      if (!(f)) throw AssertionException(__FILE__, __LINE__, #f);
+#define CONTRACT_CHECK(kind, exception, f) \
+      { if (!(f)) [[unlikely]] { \
+          static ContractSite s_contractSite(kind, __FILE__, __LINE__, #f); \
+          s_contractSite.recordViolation(); \
+          throw exception(__FILE__, __LINE__, #f); } }
+
+#if CONTRACT_LEVEL >= 1
 #  define PRECONDITION(f)  \
-      if (!(f)) throw PreconditionException(__FILE__, __LINE__, #f);
+      CONTRACT_CHECK("PRECONDITION", PreconditionException, f)
+#else
+#  define PRECONDITION(f) {}
+#endif
+
+#define CONTRACT_SAMPLED(check) \
+      { static thread_local unsigned int s_contractCalls = 0; \
+        if (s_contractCalls++ % CONTRACT_SAMPLE_RATE == 0) check }
+
+#if CONTRACT_LEVEL >= 3
 #  define POSTCONDITION(f) \
-      if (!(f)) throw PostconditionException(__FILE__, __LINE__, #f);
-#  define INVARIANT(f)   \
-      if (!(f)) throw InvariantException(__FILE__, __LINE__, #f);
+      CONTRACT_CHECK("POSTCONDITION", PostconditionException, f)
+#  define ASSERTION(f)     \
+      CONTRACT_CHECK("ASSERTION", AssertionException, f)
+#elif CONTRACT_LEVEL == 2
+#  define POSTCONDITION(f) \
+      CONTRACT_SAMPLED(CONTRACT_CHECK("POSTCONDITION", PostconditionException, f))
+#  define ASSERTION(f)     \
+      CONTRACT_SAMPLED(CONTRACT_CHECK("ASSERTION", AssertionException, f))
+#endif
 
-// --- Release mode
+#if CONTRACT_LEVEL >= 2
+#  define INVARIANT(f)     \
+      CONTRACT_CHECK("INVARIANT", InvariantException, f)
 #else
+#  define POSTCONDITION(f) {}
+#  define ASSERTION(f) {}
+#  define INVARIANT(f) {}
+#endif
 
-#  define PRECONDITION(f);
-#  define POSTCONDITION(f);
-#  define INVARIANTS();
-#  define INVARIANT(f);
-#  define ASSERTION(f);
+#if CONTRACT_LEVEL >= 3
+#  define INVARIANTS() \
+      verifieInvariant()
+#elif CONTRACT_LEVEL == 2
+#  define INVARIANTS() \
+      CONTRACT_SAMPLED(verifieInvariant();)
+#else
+#  define INVARIANTS() {}
+#endif
 
-#endif  // --- if !defined (NDEBUG)
 #endif  // --- ifndef CONTRATEXCEPTION_H_ALREADY_INCLUDED
\ No newline at end of file
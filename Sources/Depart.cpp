@@ -8,6 +8,7 @@
 #include "Flight.h"
 #include "validationFormat.h"
 #include "ContratException.h"
+#include "trace.h"
 #include <sstream>
 namespace aerien{
     using namespace std;
@@ -27,29 +28,55 @@ namespace aerien{
      * \pre util::isValidGate(p_boardingGate) must return true.
      * \pre util::isValid24Format(p_boardingHour) must return true.
      * \post The boarding gate and boarding time are initialized with the specified values.
+     * \throws FlightException if a field is longer than it can hold.
      */
     Depart::Depart (const string & p_number,const string & p_company,const string & p_hour,const string & p_city,
                     const string& p_boardingHour,const string& p_boardingGate):
-                    Flight(p_number, p_company, p_hour, p_city),
-                    m_boardingHour(p_boardingHour),m_boardingGate(p_boardingGate)
+                    Flight(p_number, p_company, p_hour, p_city)
     {
+      TRACE_SPAN("Depart validation");
       PRECONDITION(util::isValidGate(p_boardingGate));
       PRECONDITION(util::isValid24Format(p_boardingHour));
-      POSTCONDITION(m_boardingHour == p_boardingHour);
-      POSTCONDITION(m_boardingGate == p_boardingGate);
+      m_boardingHour = toField<HourText>(p_boardingHour, "boarding hour");
+      m_boardingGate = toField<GateText>(p_boardingGate, "boarding gate");
+      POSTCONDITION(getBoardingHourView() == p_boardingHour);
+      POSTCONDITION(getBoardingGateView() == p_boardingGate);
       INVARIANTS();
     }
 
 
+    /**
+     * \brief Constructor of the Depart class from compile-time validated fields.
+     *
+     * Used for hard-coded flights such as
+     * Depart("AC1636"_fn, "AIR CANADA"_name, "18:00"_hour, "ORLONDO"_name, "17:15"_hour, "C86"_gate);
+     * neither the preconditions nor the invariant are evaluated at run time.
+     *
+     * \param[in] p_number The flight number.
+     * \param[in] p_company The airline company name.
+     * \param[in] p_hour The departure time in 24-hour format.
+     * \param[in] p_city The departure city of the flight.
+     * \param[in] p_boardingHour The boarding time in 24-hour format.
+     * \param[in] p_boardingGate The boarding gate for the flight.
+     */
+    Depart::Depart (const util::FlightNumber & p_number, const util::Name & p_company,
+                    const util::Hour & p_hour, const util::Name & p_city,
+                    const util::Hour & p_boardingHour, const util::Gate & p_boardingGate):
+                    Flight(p_number, p_company, p_hour, p_city),
+                    m_boardingGate(p_boardingGate.value()), m_boardingHour(p_boardingHour.value())
+    {
+    }
+
  /**
      * \brief Sets the boarding gate for the departure flight.
      *
      * \param[in] p_boardingGate The new boarding gate.
+     * \throws FlightException if p_boardingGate is longer than a gate.
      */
     void Depart::setBoardingGate (const std::string& p_boardingGate){
       PRECONDITION(util::isValidGate(p_boardingGate));
-      m_boardingGate = p_boardingGate;
-      POSTCONDITION(m_boardingGate==p_boardingGate);
+      m_boardingGate = toField<GateText>(p_boardingGate, "boarding gate");
+      POSTCONDITION(getBoardingGateView()==p_boardingGate);
       INVARIANTS ();
     }
 
@@ -58,11 +85,12 @@ namespace aerien{
      * \brief Sets the boarding time for the departure flight.
      *
      * \param[in] p_boardingHour The new boarding time.
+     * \throws FlightException if p_boardingHour is longer than an hour.
      */
     void Depart::setBoardingHour (const std::string& p_boardingHour){
       PRECONDITION(util::isValid24Format(p_boardingHour));
-      m_boardingHour=p_boardingHour;
-      POSTCONDITION(m_boardingHour==p_boardingHour);
+      m_boardingHour=toField<HourText>(p_boardingHour, "boarding hour");
+      POSTCONDITION(getBoardingHourView()==p_boardingHour);
       INVARIANTS ();
     }
 
@@ -70,18 +98,36 @@ namespace aerien{
    /**
      * \brief Accessor to get the boarding gate of the departure flight.
      *
-     * \return A constant reference to the string containing the boarding gate.
+     * \return A copy of the boarding gate.
      */
-    const string& Depart::getBoardingGate () const{
-      return m_boardingGate;
+    string Depart::getBoardingGate () const{
+      return m_boardingGate.str();
     }
 
     /**
      * \brief Accessor to get the boarding time of the departure flight.
      *
-     * \return A constant reference to the string containing the boarding time.
+     * \return A copy of the boarding time.
      */
-    const string& Depart::getBoardingHour () const{
+    string Depart::getBoardingHour () const{
+      return m_boardingHour.str();
+    }
+
+    /**
+     * \brief Returns the boarding gate without copying it.
+     *
+     * \return A view of the boarding gate, valid as long as the flight.
+     */
+    string_view Depart::getBoardingGateView () const{
+      return m_boardingGate;
+    }
+
+    /**
+     * \brief Returns the boarding time without copying it.
+     *
+     * \return A view of the boarding time, valid as long as the flight.
+     */
+    string_view Depart::getBoardingHourView () const{
       return m_boardingHour;
     }
 
@@ -92,7 +138,7 @@ namespace aerien{
      */
     string Depart::getFlightFormatted() const{
       ostringstream os;
-      os << Flight::getFlightFormatted()<<m_boardingHour<<"| "<< m_boardingGate<< " |";
+      os << Flight::getFlightFormatted()<<getBoardingHourView()<<"| "<< getBoardingGateView()<< " |";
       return os.str();
     }
 
@@ -103,8 +149,31 @@ namespace aerien{
      * \return A unique pointer to a copy of the Depart object.
      */
     unique_ptr<Flight> Depart::clone() const{
+        TRACE_SPAN("Depart::clone");
         return make_unique <Depart> (*this); 
     }
+
+    /**
+     * \brief Copies the departure and its control block into a memory resource.
+     *
+     * \param[in] p_resource The memory resource of the copy.
+     * \return A shared pointer to the copy.
+     */
+    shared_ptr<Flight> Depart::share(pmr::memory_resource* p_resource) const{
+        TRACE_SPAN("Depart::share");
+        return allocate_shared<Depart>(pmr::polymorphic_allocator<Depart>(p_resource), *this);
+    }
+
+    /**
+     * \brief Adds the Depart object, its fields included, to a memory breakdown.
+     *
+     * \param[in,out] p_usage The breakdown to complete.
+     */
+    void Depart::addMemoryUsage(MemoryUsage& p_usage) const{
+        p_usage.m_objects += sizeof(Depart);
+        p_usage.addAllocation(sizeof(Depart));
+        Flight::addMemoryUsage(p_usage);
+    }
     
     /**
      * \brief Checks the invariant of the Depart class.
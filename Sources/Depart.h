@@ -19,20 +19,27 @@ namespace aerien{
     public:
       Depart (const std::string & p_number, const std::string & p_company,
              const std::string & p_hour, const std::string & p_city, const std::string& p_boardingGate, const std::string& p_boardingHour);
-      
+      Depart (const util::FlightNumber & p_number, const util::Name & p_company,
+             const util::Hour & p_hour, const util::Name & p_city, const util::Hour & p_boardingHour,
+             const util::Gate & p_boardingGate);
       void setBoardingHour(const std::string& p_boardingHour);
       void setBoardingGate(const std::string& p_boardingGate);
-      const std::string& getBoardingGate()const;
-      const std::string& getBoardingHour()const;
+      std::string getBoardingGate()const;
+      std::string getBoardingHour()const;
+      std::string_view getBoardingGateView()const;
+      std::string_view getBoardingHourView()const;
       virtual std::string getFlightFormatted() const;
       virtual std::unique_ptr<Flight> clone() const;
+      virtual std::shared_ptr<Flight> share(std::pmr::memory_resource* p_resource) const;
+      virtual void addMemoryUsage(MemoryUsage& p_usage) const;
       virtual ~Depart (){};
       
       
     private:
-    
-      std::string m_boardingGate;
-      std::string m_boardingHour;
+      typedef util::FixedString<util::GATE_LENGTH> GateText;
+
+      GateText m_boardingGate;
+      HourText m_boardingHour;
       void verifieInvariant() const;
 
     };
@@ -0,0 +1,356 @@
+/**
+ * \file   Executor.cpp
+ * \brief  File containing the implementation of the Executor class
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "Executor.h"
+#include "trace.h"
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace aerien{
+    using namespace std;
+
+    namespace
+    {
+      // Worker of the calling thread, if it belongs to a pool
+      thread_local Executor* t_executor = nullptr;
+      thread_local size_t t_worker = 0;
+
+      mutex s_instanceMutex;
+      size_t s_instanceThreads = 0;
+      bool s_instancePin = false;
+      bool s_instanceCreated = false;
+    }
+
+    /**
+     * \brief Constructor of the Executor class; starts the workers.
+     *
+     * \param[in] p_threads The number of workers; 0 uses one per core.
+     * \param[in] p_pinWorkers true to pin worker i to core i modulo the number of cores (Linux only).
+     */
+    Executor::Executor (size_t p_threads, bool p_pinWorkers): m_queued(0), m_nextWorker(0), m_stop(false)
+    {
+      size_t threads = p_threads != 0 ? p_threads : max(1u, thread::hardware_concurrency());
+      for (size_t i = 0; i < threads; ++i)
+        {
+          m_workers.push_back(make_unique<Worker>());
+        }
+      for (size_t i = 0; i < threads; ++i)
+        {
+          m_workers[i]->m_thread = thread(&Executor::run, this, i, p_pinWorkers);
+        }
+    }
+
+    /**
+     * \brief Destructor: the tasks already queued are run, then the workers stop.
+     */
+    Executor::~Executor ()
+    {
+      {
+        lock_guard<mutex> lock(m_sleepMutex);
+        m_stop = true;
+      }
+      m_wakeUp.notify_all();
+      for (auto& worker : m_workers)
+        {
+          worker->m_thread.join();
+        }
+    }
+
+    /**
+     * \brief Returns the executor of the library, created on first use.
+     *
+     * Its size and pinning are the ones given to configure(), by default one
+     * unpinned worker per core.
+     */
+    Executor& Executor::instance ()
+    {
+      static Executor* s_instance = []
+      {
+        lock_guard<mutex> lock(s_instanceMutex);
+        s_instanceCreated = true;
+        // Never destroyed: tasks may still be submitted during static destruction
+        return new Executor(s_instanceThreads, s_instancePin);
+      }();
+      return *s_instance;
+    }
+
+    /**
+     * \brief Sets the size and pinning of the library executor.
+     *
+     * \param[in] p_threads The number of workers; 0 uses one per core.
+     * \param[in] p_pinWorkers true to pin the workers to cores.
+     * \return false if the executor already exists, in which case nothing changes.
+     */
+    bool Executor::configure (size_t p_threads, bool p_pinWorkers)
+    {
+      lock_guard<mutex> lock(s_instanceMutex);
+      if (s_instanceCreated)
+        {
+          return false;
+        }
+      s_instanceThreads = p_threads;
+      s_instancePin = p_pinWorkers;
+      return true;
+    }
+
+    /**
+     * \brief Returns the number of workers.
+     */
+    size_t Executor::size () const
+    {
+      return m_workers.size();
+    }
+
+    /**
+     * \brief Queues a task. From a worker of this pool, it goes to the back of its own deque.
+     *
+     * \param[in] p_task The task; an exception escaping it terminates the program,
+     *            use a TaskGroup to get it back.
+     */
+    void Executor::submit (function<void()> p_task)
+    {
+      if (t_executor == this)
+        {
+          push(t_worker, move(p_task));
+        }
+      else
+        {
+          push(m_nextWorker.fetch_add(1, memory_order_relaxed) % m_workers.size(), move(p_task));
+        }
+    }
+
+    /**
+     * \brief Adds a task at the back of a deque and wakes up a sleeping worker.
+     *
+     * The task is counted before it is queued, so the count never goes below zero.
+     */
+    void Executor::push (size_t p_worker, function<void()> p_task)
+    {
+      {
+        lock_guard<mutex> lock(m_sleepMutex);
+        m_queued.fetch_add(1);
+      }
+      {
+        lock_guard<mutex> lock(m_workers[p_worker]->m_mutex);
+        m_workers[p_worker]->m_tasks.push_back(move(p_task));
+      }
+      m_wakeUp.notify_one();
+    }
+
+    /**
+     * \brief Takes the newest task of a worker's own deque.
+     */
+    bool Executor::popLocal (size_t p_worker, function<void()>& p_task)
+    {
+      Worker& worker = *m_workers[p_worker];
+      lock_guard<mutex> lock(worker.m_mutex);
+      if (worker.m_tasks.empty())
+        {
+          return false;
+        }
+      p_task = move(worker.m_tasks.back());
+      worker.m_tasks.pop_back();
+      m_queued.fetch_sub(1);
+      return true;
+    }
+
+    /**
+     * \brief Takes the oldest task of another deque, starting after the thief.
+     */
+    bool Executor::steal (size_t p_thief, function<void()>& p_task)
+    {
+      size_t count = m_workers.size();
+      for (size_t i = 1; i <= count; ++i)
+        {
+          Worker& victim = *m_workers[(p_thief + i) % count];
+          lock_guard<mutex> lock(victim.m_mutex);
+          if (!victim.m_tasks.empty())
+            {
+              p_task = move(victim.m_tasks.front());
+              victim.m_tasks.pop_front();
+              m_queued.fetch_sub(1);
+              return true;
+            }
+        }
+      return false;
+    }
+
+    /**
+     * \brief Runs one pending task, from the calling worker's deque first.
+     * \return false if no task was found.
+     */
+    bool Executor::tryRunOne ()
+    {
+      function<void()> task;
+      size_t self = t_executor == this ? t_worker : 0;
+      if ((t_executor == this && popLocal(self, task)) || steal(self, task))
+        {
+          task();
+          return true;
+        }
+      return false;
+    }
+
+    /**
+     * \brief Loop of a worker: runs tasks, sleeps when there is none.
+     */
+    void Executor::run (size_t p_index, bool p_pin)
+    {
+#ifdef __linux__
+      if (p_pin)
+        {
+          cpu_set_t cpus;
+          CPU_ZERO(&cpus);
+          CPU_SET(p_index % max(1u, thread::hardware_concurrency()), &cpus);
+          pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+        }
+#else
+      (void) p_pin;
+#endif
+      t_executor = this;
+      t_worker = p_index;
+      util::setTraceThreadName("executor worker " + to_string(p_index));
+      for (;;)
+        {
+          if (tryRunOne())
+            {
+              continue;
+            }
+          unique_lock<mutex> lock(m_sleepMutex);
+          m_wakeUp.wait(lock, [this] { return m_stop || m_queued.load() != 0; });
+          if (m_stop && m_queued.load() == 0)
+            {
+              return;
+            }
+        }
+    }
+
+    /**
+     * \brief Constructor of a task group.
+     *
+     * \param[in] p_executor The executor running the forked tasks.
+     */
+    Executor::TaskGroup::TaskGroup (Executor& p_executor): m_executor(p_executor), m_state(make_shared<State>())
+    {
+    }
+
+    /**
+     * \brief Destructor: waits for the forked tasks; their errors are dropped.
+     */
+    Executor::TaskGroup::~TaskGroup ()
+    {
+      wait();
+    }
+
+    /**
+     * \brief Starts a task of the group.
+     *
+     * \param[in] p_task The task; its exception, if any, is rethrown by join().
+     */
+    void Executor::TaskGroup::fork (function<void()> p_task)
+    {
+      {
+        lock_guard<mutex> lock(m_state->m_mutex);
+        m_state->m_tasks.push_back(move(p_task));
+        ++m_state->m_pending;
+      }
+      m_executor.submit([state = m_state]
+      {
+        runOne(*state, false);
+      });
+    }
+
+    /**
+     * \brief Waits for every task forked so far, running pending tasks of the group meanwhile.
+     *
+     * \throws The first exception thrown by a task of the group.
+     */
+    void Executor::TaskGroup::join ()
+    {
+      wait();
+      exception_ptr error;
+      {
+        lock_guard<mutex> lock(m_state->m_mutex);
+        error = m_state->m_error;
+        m_state->m_error = nullptr;
+      }
+      if (error)
+        {
+          rethrow_exception(error);
+        }
+    }
+
+    /**
+     * \brief Runs the tasks of the group not started yet, then waits for those
+     *        running on other threads.
+     */
+    void Executor::TaskGroup::wait ()
+    {
+      while (runOne(*m_state, true))
+        {
+        }
+      unique_lock<mutex> lock(m_state->m_mutex);
+      m_state->m_finished.wait(lock, [this] { return m_state->m_pending == 0; });
+    }
+
+    /**
+     * \brief Runs one task of a group not started yet.
+     *
+     * \param[in,out] p_state The state of the group.
+     * \param[in] p_newest true to take the newest task, as the joiner does;
+     *            the tickets take the oldest one.
+     * \return false if every task of the group was already started.
+     */
+    bool Executor::TaskGroup::runOne (State& p_state, bool p_newest)
+    {
+      function<void()> task;
+      {
+        lock_guard<mutex> lock(p_state.m_mutex);
+        if (p_state.m_tasks.empty())
+          {
+            return false;
+          }
+        if (p_newest)
+          {
+            task = move(p_state.m_tasks.back());
+            p_state.m_tasks.pop_back();
+          }
+        else
+          {
+            task = move(p_state.m_tasks.front());
+            p_state.m_tasks.pop_front();
+          }
+      }
+      exception_ptr error;
+      try
+        {
+          task();
+        }
+      catch (...)
+        {
+          error = current_exception();
+        }
+      // Released before the joiner may return: the captures can refer to its frame
+      task = nullptr;
+      bool finished;
+      {
+        lock_guard<mutex> lock(p_state.m_mutex);
+        if (error && !p_state.m_error)
+          {
+            p_state.m_error = error;
+          }
+        finished = --p_state.m_pending == 0;
+      }
+      if (finished)
+        {
+          p_state.m_finished.notify_all();
+        }
+      return true;
+    }
+}
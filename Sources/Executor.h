@@ -0,0 +1,153 @@
+/**
+ \file Executor.h
+ \brief File containing the declaration of the Executor class
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aerien
+{
+  /**
+   * \class Executor
+   * \brief Work-stealing thread pool shared by the parallel parts of the library.
+   *
+   * Each worker owns a deque: it pushes and pops the tasks it forks at the
+   * back, while idle workers steal the oldest tasks at the front of the
+   * others. Tasks submitted from outside the pool are dealt round-robin.
+   * A thread joining a TaskGroup runs the group's own tasks not started yet
+   * instead of blocking, so groups may be nested and joined from inside a
+   * task; it never runs the tasks of other groups, so a join cannot be
+   * caught in unrelated work that waits for what the joiner holds.
+   */
+  class Executor
+  {
+  public:
+    /**
+     * \class TaskGroup
+     * \brief Fork/join scope: tasks forked on an executor and joined together.
+     *
+     * The tasks wait in the group's own queue; each one submitted to the
+     * executor is a ticket running the oldest of them, if the joiner has not
+     * taken it meanwhile. The tickets share the state of the group, so those
+     * left in the executor after the group is gone find nothing to run.
+     */
+    class TaskGroup
+    {
+    public:
+      explicit TaskGroup (Executor& p_executor);
+      ~TaskGroup ();
+      TaskGroup (const TaskGroup&) = delete;
+      TaskGroup& operator= (const TaskGroup&) = delete;
+
+      void fork (std::function<void()> p_task);
+      void join ();
+
+    private:
+      /**
+       * \struct State
+       * \brief Tasks and completion of a group, shared with its tickets.
+       */
+      struct State
+      {
+        std::mutex m_mutex;
+        std::condition_variable m_finished;           ///< Notified when m_pending drops to 0.
+        std::deque<std::function<void()>> m_tasks;    ///< Forked, not started yet.
+        std::size_t m_pending = 0;                    ///< Forked, not finished yet.
+        std::exception_ptr m_error;
+      };
+
+      static bool runOne (State& p_state, bool p_newest);
+      void wait ();
+
+      Executor& m_executor;
+      std::shared_ptr<State> m_state;
+    };
+
+    explicit Executor (std::size_t p_threads = 0, bool p_pinWorkers = false);
+    ~Executor ();
+    Executor (const Executor&) = delete;
+    Executor& operator= (const Executor&) = delete;
+
+    static Executor& instance ();
+    static bool configure (std::size_t p_threads, bool p_pinWorkers);
+
+    std::size_t size () const;
+    void submit (std::function<void()> p_task);
+
+    template <typename Body>
+    void parallelFor (std::size_t p_begin, std::size_t p_end, std::size_t p_grain, Body p_body);
+
+  private:
+    /**
+     * \struct Worker
+     * \brief A thread of the pool with its deque of tasks.
+     */
+    struct alignas(64) Worker
+    {
+      std::mutex m_mutex;
+      std::deque<std::function<void()>> m_tasks;
+      std::thread m_thread;
+    };
+
+    void run (std::size_t p_index, bool p_pin);
+    void push (std::size_t p_worker, std::function<void()> p_task);
+    bool tryRunOne ();
+    bool popLocal (std::size_t p_worker, std::function<void()>& p_task);
+    bool steal (std::size_t p_thief, std::function<void()>& p_task);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<std::size_t> m_queued;
+    std::atomic<std::size_t> m_nextWorker;
+    std::atomic<bool> m_stop;
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeUp;
+  };
+
+  /**
+   * \brief Runs p_body over [p_begin, p_end) cut into ranges of about p_grain indexes.
+   *
+   * \param[in] p_begin The first index.
+   * \param[in] p_end The index after the last one.
+   * \param[in] p_grain The minimum number of indexes given to a task.
+   * \param[in] p_body A callable taking (std::size_t begin, std::size_t end).
+   */
+  template <typename Body>
+  void Executor::parallelFor (std::size_t p_begin, std::size_t p_end, std::size_t p_grain, Body p_body)
+  {
+    if (p_end <= p_begin)
+      return;
+    std::size_t grain = std::max<std::size_t>(1, p_grain);
+    std::size_t chunks = std::min((p_end - p_begin + grain - 1) / grain, 4 * (size() + 1));
+    if (chunks <= 1)
+      {
+        p_body(p_begin, p_end);
+        return;
+      }
+    TaskGroup group(*this);
+    std::size_t count = p_end - p_begin;
+    for (std::size_t c = 1; c < chunks; ++c)
+      {
+        std::size_t begin = p_begin + count * c / chunks;
+        std::size_t end = p_begin + count * (c + 1) / chunks;
+        group.fork([&p_body, begin, end] { p_body(begin, end); });
+      }
+    p_body(p_begin, p_begin + count / chunks);
+    group.join();
+  }
+}
+
+#endif /* EXECUTOR_H */
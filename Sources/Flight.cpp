@@ -7,6 +7,7 @@
 #include "Flight.h"
 #include "validationFormat.h"
 #include "ContratException.h"
+#include "trace.h"
 #include <sstream>
 
 namespace aerien{
@@ -26,24 +27,49 @@ namespace aerien{
      * \pre util::isValid24Format(p_hour) must return true.
      * \pre util::isValidName(p_city) must return true.
      * \post The flight number, company name, departure time, and city are initialized with the specified values.
+     * \throws FlightException if a field is longer than it can hold.
      */
      Flight::Flight (const string & p_number,const string & p_company,
-             const string & p_hour,const string & p_city):
-     m_number(p_number),m_company(p_company), m_hour(p_hour), m_city(p_city)
+             const string & p_hour,const string & p_city)
      {        
+            TRACE_SPAN("Flight validation");
             PRECONDITION(util::isValidNumber(p_number));
             PRECONDITION(util::isValidName(p_company));
             PRECONDITION(util::isValid24Format(p_hour));
             PRECONDITION(util::isValidName(p_city));
+            // The fields are copied once they are known to fit
+            m_number = toField<NumberText>(p_number, "flight number");
+            m_company = toField<NameText>(p_company, "company");
+            m_hour = toField<HourText>(p_hour, "hour");
+            m_city = toField<NameText>(p_city, "city");
             
-            POSTCONDITION(m_number == p_number);
-            POSTCONDITION(m_company == p_company);
-            POSTCONDITION(m_hour == p_hour);
-            POSTCONDITION(m_city == p_city);
+            POSTCONDITION(getNumberView() == p_number);
+            POSTCONDITION(getCompanyView() == p_company);
+            POSTCONDITION(getHourView() == p_hour);
+            POSTCONDITION(getCityView() == p_city);
                   
             INVARIANTS();
      }
 
+    /**
+     * \brief Constructor for the Flight class from compile-time validated fields.
+     *
+     * The fields were checked when their literals were compiled, so neither
+     * the preconditions of the main constructor nor the invariant, which
+     * repeats the same checks, are evaluated again.
+     *
+     * \param[in] p_number The flight number.
+     * \param[in] p_company The airline company name.
+     * \param[in] p_hour The departure time in 24-hour format.
+     * \param[in] p_city The departure city of the flight.
+     */
+     Flight::Flight (const util::FlightNumber & p_number, const util::Name & p_company,
+                     const util::Hour & p_hour, const util::Name & p_city):
+     m_number(p_number.value()), m_company(p_company.value()), m_hour(p_hour.value()), m_city(p_city.value())
+     {
+     }
+
+
     /**
      * \brief Sets a new departure time for the flight.
      *
@@ -53,12 +79,13 @@ namespace aerien{
      *
      * \pre util::isValid24Format(p_hour) must return true.
      * \post The departure time is updated only if the parameter is valid. Otherwise, a contract error will be generated.
+     * \throws FlightException if p_hour is longer than an hour.
      */     
      void Flight::setHour(const std::string & p_hour)
     {
         PRECONDITION(util::isValid24Format(p_hour)) 
-        m_hour = p_hour;
-        POSTCONDITION(m_hour == p_hour);
+        m_hour = toField<HourText>(p_hour, "hour");
+        POSTCONDITION(getHourView() == p_hour);
         INVARIANTS ();
     }
 
@@ -87,46 +114,107 @@ namespace aerien{
     string Flight::getFlightFormatted() const{
         ostringstream oss;
 
-        oss << "|" << m_number << "|" <<util::adjustWidth(m_company);
-        oss << "|" << m_hour <<"|" <<util::adjustWidth(m_city)<< "|" ;
+        oss << "|" << getNumberView() << "|" <<util::adjustWidth(m_company);
+        oss << "|" << getHourView() <<"|" <<util::adjustWidth(m_city)<< "|" ;
 
         return oss.str();
     }
+
+    /**
+     * \brief Copies the flight into a memory resource, shared by the readers of an Airport.
+     *
+     * Depart and Arrival allocate the copy and its shared_ptr control block
+     * from p_resource, as a single block. A flight class that does not override
+     * this method is copied by clone(), on the heap.
+     *
+     * \param[in] p_resource The memory resource of the copy.
+     * \return A shared pointer to the copy.
+     */
+    shared_ptr<Flight> Flight::share(pmr::memory_resource*) const{
+        return shared_ptr<Flight>(clone());
+    }
+
+    /**
+     * \brief Adds the heap memory of the Flight fields to a memory breakdown.
+     *
+     * The fields are stored inline, so there is none; the derived classes add
+     * their own object, then call this method.
+     *
+     * \param[in,out] p_usage The breakdown to complete.
+     */
+    void Flight::addMemoryUsage(MemoryUsage&) const{
+    }
     
     /**
      * \brief Returns the flight number.
      *
-     * \return A constant reference to the string representing the flight number.
+     * \return A copy of the flight number.
      */
-    const string & Flight::getNumber()const{
-      return m_number;
+    string Flight::getNumber()const{
+      return m_number.str();
     }
 
     /**
      * \brief Returns the airline company name.
      *
-     * \return A constant reference to the string representing the airline company name.
+     * \return A copy of the airline company name.
      */
-    const string & Flight::getCompany()const{
-      return m_company;
+    string Flight::getCompany()const{
+      return m_company.str();
     }
 
     /**
      * \brief Returns the departure time of the flight.
      *
-     * \return A constant reference to the string representing the departure time.
+     * \return A copy of the departure time.
      */
-    const string & Flight::getHour()const{
-      return m_hour;
+    string Flight::getHour()const{
+      return m_hour.str();
     }
 
 
     /**
      * \brief Returns the departure city of the flight.
      *
-     * \return A constant reference to the string representing the departure city.
+     * \return A copy of the departure city.
+     */
+    string Flight::getCity()const{
+      return m_city.str();
+    }
+
+    /**
+     * \brief Returns the flight number without copying it.
+     *
+     * \return A view of the flight number, valid as long as the flight.
+     */
+    string_view Flight::getNumberView()const{
+      return m_number;
+    }
+
+    /**
+     * \brief Returns the airline company name without copying it.
+     *
+     * \return A view of the airline company name, valid as long as the flight.
+     */
+    string_view Flight::getCompanyView()const{
+      return m_company;
+    }
+
+    /**
+     * \brief Returns the departure time of the flight without copying it.
+     *
+     * \return A view of the departure time, valid as long as the flight.
+     */
+    string_view Flight::getHourView()const{
+      return m_hour;
+    }
+
+    /**
+     * \brief Returns the departure city of the flight without copying it.
+     *
+     * \return A view of the departure city, valid as long as the flight.
      */
-    const string & Flight::getCity()const{
+    string_view Flight::getCityView()const{
       return m_city;
     }
     
@@ -8,7 +8,13 @@
 #ifndef FLIGHT_H
 #define FLIGHT_H
 #include <string>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
+#include "fieldLiterals.h"
+#include "fixedString.h"
+#include "FlightException.h"
+#include "MemoryUsage.h"
 
 namespace aerien{
     /**
@@ -16,6 +22,11 @@ namespace aerien{
      * \brief Class representing an air flight.
      *
      * This class models a flight with a number, an airline, a departure time and a destination city.
+     *
+     * The fields are bounded by their validators and are stored inline, so a
+     * flight is a single block that a copy duplicates without any allocation.
+     * The getters return copies of the fields; the View accessors return
+     * views of them that live as long as the flight.
      */
     class Flight
     {
@@ -23,26 +34,63 @@ namespace aerien{
         Flight (const std::string & p_number,const std::string & p_company,
              const std::string & p_hour,const std::string & p_city);
 
-        const std::string & getNumber()const;
-        const std::string & getCompany()const;
-        const std::string & getHour()const;
-        const std::string & getCity()const;
+        std::string getNumber()const;
+        std::string getCompany()const;
+        std::string getHour()const;
+        std::string getCity()const;
+        std::string_view getNumberView()const;
+        std::string_view getCompanyView()const;
+        std::string_view getHourView()const;
+        std::string_view getCityView()const;
         void setHour(const std::string & p_hour);
         bool operator == (const Flight& p_flight )const;
         virtual std::string getFlightFormatted() const;
         virtual std::unique_ptr<Flight> clone ()const = 0;   
+        virtual std::shared_ptr<Flight> share (std::pmr::memory_resource* p_resource) const;
+        virtual void addMemoryUsage (MemoryUsage& p_usage) const;
         virtual ~Flight (){};
          
+    protected:
+        typedef util::FixedString<util::NUMBER_LENGTH> NumberText;
+        typedef util::FixedString<util::NAME_MAX_LENGTH> NameText;
+        typedef util::FixedString<util::HOUR_LENGTH> HourText;
+
+        template <typename Text>
+        static Text toField (const std::string& p_text, const char* p_field);
+
+        Flight (const util::FlightNumber & p_number, const util::Name & p_company,
+                const util::Hour & p_hour, const util::Name & p_city);
         
     private:      
-      std::string m_number;
-      std::string m_company;
-      std::string m_hour;
-      std::string m_city;
+      NumberText m_number;
+      NameText m_company;
+      HourText m_hour;
+      NameText m_city;
       
       void verifieInvariant() const;
 
     };
+
+    /**
+     * \brief Copies a text into a bounded field.
+     *
+     * The length is checked even when the contracts are compiled out, so a
+     * text that cannot be stored is reported rather than truncated.
+     *
+     * \param[in] p_text The text of the field.
+     * \param[in] p_field The name of the field, for the message.
+     * \return The field holding p_text.
+     * \throws FlightException if p_text is longer than the capacity of the field.
+     */
+    template <typename Text>
+    Text Flight::toField (const std::string& p_text, const char* p_field)
+    {
+      if (p_text.size() > Text::capacity())
+        {
+          throw FlightException(std::string("Invalid ") + p_field + " :\n" + p_text);
+        }
+      return Text(p_text);
+    }
 }
 #endif /* FLIGHT_H */
 
@@ -0,0 +1,232 @@
+/**
+ * \file   FlightSearchIndex.cpp
+ * \brief  File containing the implementation of the FlightSearchIndex class
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "FlightSearchIndex.h"
+#include "Depart.h"
+#include "ContratException.h"
+#include "trace.h"
+#include <algorithm>
+
+namespace aerien{
+    using namespace std;
+
+    namespace
+    {
+      /**
+       * \brief Calls p_action with each word of a name taken to the end of the name.
+       */
+      template <typename Action>
+      void forEachWordSuffix (string_view p_name, Action p_action)
+      {
+        for (size_t i = 0; i < p_name.size(); ++i)
+          {
+            if (i == 0 || p_name[i - 1] == ' ' || p_name[i - 1] == '-')
+              {
+                p_action(p_name.substr(i));
+              }
+          }
+      }
+
+      /**
+       * \brief Calls p_action with each searchable term of a flight.
+       */
+      template <typename Action>
+      void forEachTerm (const Flight& p_flight, Action p_action)
+      {
+        p_action(p_flight.getNumberView());
+        forEachWordSuffix(p_flight.getCompanyView(), p_action);
+        forEachWordSuffix(p_flight.getCityView(), p_action);
+        if (const Depart* depart = dynamic_cast<const Depart*>(&p_flight))
+          {
+            p_action(depart->getBoardingGateView());
+          }
+      }
+
+      /**
+       * \brief Packs the first 8 bytes of a text, big-endian and padded with zeros,
+       *        so that keys compare like the texts they start.
+       */
+      uint64_t keyOf (string_view p_text)
+      {
+        uint64_t key = 0;
+        for (size_t i = 0; i < 8; ++i)
+          {
+            key = key << 8 | (i < p_text.size() ? static_cast<unsigned char>(p_text[i]) : 0u);
+          }
+        return key;
+      }
+    }
+
+    /**
+     * \brief Constructor of an empty index.
+     */
+    FlightSearchIndex::FlightSearchIndex ()
+    {
+    }
+
+    /**
+     * \brief Constructor of the index of a list of flights.
+     *
+     * \param[in] p_flights The flights, in the order search() reports their positions.
+     * \pre No flight is null.
+     */
+    FlightSearchIndex::FlightSearchIndex (vector<shared_ptr<const Flight>> p_flights): m_flights(move(p_flights))
+    {
+      TRACE_SPAN("FlightSearchIndex build");
+      m_terms.reserve(m_flights.size() * 5);
+      for (size_t i = 0; i < m_flights.size(); ++i)
+        {
+          PRECONDITION(m_flights[i] != nullptr);
+          uint32_t position = static_cast<uint32_t>(i);
+          forEachTerm(*m_flights[i], [this, position](string_view p_term)
+          {
+            m_terms.push_back(Term{keyOf(p_term), p_term, position});
+          });
+        }
+      sort(m_terms.begin(), m_terms.end(), precedes);
+    }
+
+    /**
+     * \brief Returns the positions of the flights matching a query.
+     *
+     * \param[in] p_query The query; blank, it matches every flight.
+     * \return The positions of the matching flights, ascending.
+     */
+    vector<size_t> FlightSearchIndex::search (string_view p_query) const
+    {
+      vector<bool> matches;
+      vector<size_t> positions;
+      positions.reserve(search(p_query, matches));
+      for (size_t i = 0; i < matches.size(); ++i)
+        {
+          if (matches[i])
+            {
+              positions.push_back(i);
+            }
+        }
+      return positions;
+    }
+
+    /**
+     * \brief Marks the flights matching a query.
+     *
+     * Costs a binary search plus the terms matched, with no sort of the
+     * result, however many flights a short query matches.
+     *
+     * \param[in] p_query The query; blank, it matches every flight.
+     * \param[out] p_matches Resized to size(), true at the position of each matching flight.
+     * \return The number of matching flights.
+     */
+    size_t FlightSearchIndex::search (string_view p_query, vector<bool>& p_matches) const
+    {
+      string query = normalize(p_query);
+      if (query.empty())
+        {
+          p_matches.assign(m_flights.size(), true);
+          return m_flights.size();
+        }
+      p_matches.assign(m_flights.size(), false);
+      size_t count = 0;
+      forEachMatch(query, [&p_matches, &count](uint32_t p_position)
+      {
+        if (!p_matches[p_position])
+          {
+            p_matches[p_position] = true;
+            ++count;
+          }
+      });
+      return count;
+    }
+
+    /**
+     * \brief Returns the number of flights indexed.
+     */
+    size_t FlightSearchIndex::size () const
+    {
+      return m_flights.size();
+    }
+
+    /**
+     * \brief Calls p_action with the position of the flight of each term
+     *        starting with a normalized, non-empty query.
+     *
+     * A query of at most 8 bytes is decided on the keys alone, without
+     * reading the flights.
+     */
+    template <typename Action>
+    void FlightSearchIndex::forEachMatch (const string& p_query, Action p_action) const
+    {
+      uint64_t key = keyOf(p_query);
+      auto term = lower_bound(m_terms.begin(), m_terms.end(), Term{key, p_query, 0}, precedes);
+      if (p_query.size() <= 8)
+        {
+          uint64_t mask = ~uint64_t(0) << 8 * (8 - p_query.size());
+          for (; term != m_terms.end() && (term->m_key & mask) == key; ++term)
+            {
+              p_action(term->m_position);
+            }
+        }
+      else
+        {
+          for (; term != m_terms.end() && term->m_text.substr(0, p_query.size()) == p_query; ++term)
+            {
+              p_action(term->m_position);
+            }
+        }
+    }
+
+    /**
+     * \brief Orders the terms by text, comparing their keys first.
+     */
+    bool FlightSearchIndex::precedes (const Term& p_a, const Term& p_b)
+    {
+      return p_a.m_key != p_b.m_key ? p_a.m_key < p_b.m_key : p_a.m_text < p_b.m_text;
+    }
+
+    /**
+     * \brief Puts a query in the form of the indexed terms.
+     *
+     * \param[in] p_query The query as typed.
+     * \return The query without its leading and trailing spaces, its ASCII letters in uppercase.
+     */
+    string FlightSearchIndex::normalize (string_view p_query)
+    {
+      size_t first = p_query.find_first_not_of(' ');
+      if (first == string_view::npos)
+        {
+          return string();
+        }
+      size_t last = p_query.find_last_not_of(' ');
+      string query(p_query.substr(first, last - first + 1));
+      for (char& c : query)
+        {
+          if (c >= 'a' && c <= 'z')
+            {
+              c = static_cast<char>(c - 'a' + 'A');
+            }
+        }
+      return query;
+    }
+
+    /**
+     * \brief Checks a single flight against a query, without an index.
+     *
+     * \param[in] p_flight The flight.
+     * \param[in] p_query The query; blank, it matches every flight.
+     * \return true if search() would report the flight for this query.
+     */
+    bool FlightSearchIndex::matches (const Flight& p_flight, string_view p_query)
+    {
+      string query = normalize(p_query);
+      bool found = query.empty();
+      forEachTerm(p_flight, [&query, &found](string_view p_term)
+      {
+        found = found || p_term.substr(0, query.size()) == query;
+      });
+      return found;
+    }
+}
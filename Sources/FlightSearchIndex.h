@@ -0,0 +1,67 @@
+/**
+ \file FlightSearchIndex.h
+ \brief File containing the declaration of the FlightSearchIndex class
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef FLIGHTSEARCHINDEX_H
+#define FLIGHTSEARCHINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Flight.h"
+
+namespace aerien
+{
+  /**
+   * \class FlightSearchIndex
+   * \brief Prefix index over the searchable fields of a list of flights.
+   *
+   * The searchable terms of a flight are its number, each word of its
+   * company and of its city taken to the end of the name ("AIR CANADA" and
+   * "CANADA"), and the gate of a departure. They are kept sorted, so a query
+   * costs a binary search plus the terms it matches. A flight matches a query
+   * if one of its terms starts with the query, letters compared without case.
+   *
+   * The index shares the flights it was built from; being immutable, they
+   * stay valid whatever happens to the airport they come from.
+   */
+  class FlightSearchIndex
+  {
+  public:
+    FlightSearchIndex ();
+    explicit FlightSearchIndex (std::vector<std::shared_ptr<const Flight>> p_flights);
+
+    std::vector<std::size_t> search (std::string_view p_query) const;
+    std::size_t search (std::string_view p_query, std::vector<bool>& p_matches) const;
+    std::size_t size () const;
+
+    static std::string normalize (std::string_view p_query);
+    static bool matches (const Flight& p_flight, std::string_view p_query);
+
+  private:
+    /**
+     * \struct Term
+     * \brief A searchable term and the position of its flight.
+     */
+    struct Term
+    {
+      std::uint64_t m_key;       ///< First 8 bytes of the text, big-endian, to compare without a cache miss.
+      std::string_view m_text;   ///< Points into the flight, kept alive by m_flights.
+      std::uint32_t m_position;
+    };
+
+    static bool precedes (const Term& p_a, const Term& p_b);
+    template <typename Action>
+    void forEachMatch (const std::string& p_query, Action p_action) const;
+
+    std::vector<std::shared_ptr<const Flight>> m_flights;
+    std::vector<Term> m_terms;  ///< Sorted by text.
+  };
+}
+
+#endif /* FLIGHTSEARCHINDEX_H */
@@ -0,0 +1,78 @@
+/**
+ * \file   MemoryUsage.cpp
+ * \brief  File containing the implementation of the MemoryUsage structure
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "MemoryUsage.h"
+#include <cstdio>
+
+namespace aerien{
+    using namespace std;
+
+    namespace
+    {
+      // Allocator model: 8-byte chunk header, 16-byte granularity, 32-byte minimum chunk
+      const size_t CHUNK_HEADER = 8;
+      const size_t CHUNK_ALIGNMENT = 16;
+      const size_t MINIMUM_CHUNK = 32;
+
+      /**
+       * \brief Capacity of a string held in its small-string buffer.
+       */
+      const size_t SMALL_STRING_CAPACITY = string().capacity();
+    }
+
+    /**
+     * \brief Counts a heap block; its header and rounding are added to the slack.
+     *
+     * \param[in] p_bytes The size requested from the allocator.
+     */
+    void MemoryUsage::addAllocation (size_t p_bytes)
+    {
+      size_t chunk = (p_bytes + CHUNK_HEADER + CHUNK_ALIGNMENT - 1) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+      chunk = chunk < MINIMUM_CHUNK ? MINIMUM_CHUNK : chunk;
+      ++m_allocations;
+      m_slack += chunk - p_bytes;
+    }
+
+    /**
+     * \brief Counts the heap characters of a string member.
+     *
+     * The string object itself belongs to the object holding it; only a
+     * string too long for its small-string buffer owns a heap block.
+     *
+     * \param[in] p_text The string.
+     */
+    void MemoryUsage::addString (const string& p_text)
+    {
+      if (p_text.capacity() > SMALL_STRING_CAPACITY)
+        {
+          m_strings += p_text.size() + 1;
+          m_slack += p_text.capacity() - p_text.size();
+          addAllocation(p_text.capacity() + 1);
+        }
+    }
+
+    /**
+     * \brief Formats the breakdown, with the bytes per flight of each part.
+     */
+    string MemoryUsage::report () const
+    {
+      const pair<const char*, size_t> parts[] = {
+        {"objects", m_objects}, {"strings", m_strings}, {"slack", m_slack},
+        {"index", m_index}, {"board", m_board}, {"total", total()}
+      };
+      char line[96];
+      snprintf(line, sizeof(line), "%zu flights, %zu heap blocks\n", m_flights, m_allocations);
+      string text = line;
+      for (const auto& part : parts)
+        {
+          double perFlight = m_flights == 0 ? 0.0 : static_cast<double>(part.second) / m_flights;
+          snprintf(line, sizeof(line), "%-8s %12zu bytes %10.1f bytes/flight\n", part.first, part.second, perFlight);
+          text += line;
+        }
+      return text;
+    }
+}
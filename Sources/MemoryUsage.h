@@ -0,0 +1,44 @@
+/**
+ \file MemoryUsage.h
+ \brief File containing the declaration of the MemoryUsage structure
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef MEMORYUSAGE_H
+#define MEMORYUSAGE_H
+
+#include <cstddef>
+#include <string>
+
+namespace aerien
+{
+  /**
+   * \struct MemoryUsage
+   * \brief Breakdown of the memory held by an airport and its flights, in bytes.
+   *
+   * The sizes are computed from the objects, not measured: the allocator
+   * rounding is estimated as for a 16-byte aligned allocator with an 8-byte
+   * chunk header (glibc), and counted as slack.
+   */
+  struct MemoryUsage
+  {
+    std::size_t m_flights = 0;      ///< Flights accounted
+    std::size_t m_allocations = 0;  ///< Heap blocks holding the data below
+    std::size_t m_objects = 0;      ///< Flight objects (vtable pointer, string headers) and their shared_ptr control blocks
+    std::size_t m_strings = 0;      ///< Characters of the strings too long for the small-string buffer
+    std::size_t m_slack = 0;        ///< Unused capacity of strings and vectors, and allocator rounding
+    std::size_t m_index = 0;        ///< Hash table nodes and buckets of the shards, and the shards themselves
+    std::size_t m_board = 0;        ///< The published board: its vectors of flight pointers, handles and ranks
+
+    std::size_t total () const
+    {
+      return m_objects + m_strings + m_slack + m_index + m_board;
+    }
+
+    void addAllocation (std::size_t p_bytes);
+    void addString (const std::string& p_text);
+    std::string report () const;
+  };
+}
+
+#endif /* MEMORYUSAGE_H */
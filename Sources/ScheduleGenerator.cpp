@@ -0,0 +1,496 @@
+/**
+ * \file   ScheduleGenerator.cpp
+ * \brief  File containing the implementation of the ScheduleGenerator class
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "ScheduleGenerator.h"
+#include "ContratException.h"
+#include "Depart.h"
+#include <array>
+#include <vector>
+
+namespace aerien{
+    using namespace std;
+
+    namespace
+    {
+      /**
+       * \brief Weighted table entry; the weights of a table add up to WEIGHT_TOTAL.
+       */
+      struct Weighted
+      {
+        const char* m_name;
+        const char* m_code;
+        uint16_t m_weight;
+      };
+
+      const uint32_t WEIGHT_TOTAL = 1024;
+
+      constexpr Weighted COMPANIES[] = {
+        {"AIR CANADA", "AC", 300}, {"WESTJET", "WS", 120}, {"AIR TRANSAT", "TS", 80},
+        {"PORTER", "PD", 70}, {"DELTA", "DL", 60}, {"UNITED", "UA", 55},
+        {"AMERICAN", "AA", 50}, {"AIR FRANCE", "AF", 50}, {"LUFTHANSA", "LH", 40},
+        {"BRITISH AIRWAYS", "BA", 35}, {"KLM", "KL", 30}, {"SUNWING", "WG", 30},
+        {"SWISS", "LX", 25}, {"AEROMEXICO", "AM", 25}, {"ROYAL AIR MAROC", "AT", 20},
+        {"AIR ALGERIE", "AH", 20}, {"CANADA JETLINES", "AU", 14}
+      };
+
+      constexpr Weighted CITIES[] = {
+        {"TORONTO", "", 150}, {"VANCOUVER", "", 90}, {"CALGARY", "", 60}, {"NEW YORK", "", 80},
+        {"PARIS", "", 90}, {"CANCUN", "", 60}, {"ORLANDO", "", 50}, {"FORT LAUDERDALE", "", 45},
+        {"HALIFAX", "", 45}, {"QUEBEC", "", 40}, {"OTTAWA", "", 35}, {"WINNIPEG", "", 30},
+        {"LONDRES", "", 40}, {"MUNICH", "", 25}, {"CHICAGO", "", 35}, {"BOSTON", "", 30},
+        {"PUNTA CANA", "", 30}, {"LOS ANGELES", "", 30}, {"CASABLANCA", "", 20},
+        {"ALGER", "", 20}, {"MEXICO", "", 19}
+      };
+
+      constexpr Weighted STATUSES[] = {
+        {"OnTime", "", 614}, {"Delayed", "", 256}, {"Landed", "", 154}
+      };
+      constexpr ArrivalStatus STATUS_VALUES[] = {
+        ArrivalStatus::OnTime, ArrivalStatus::Delayed, ArrivalStatus::Landed
+      };
+
+      /**
+       * \brief Centres of the departure banks, in minutes after midnight.
+       */
+      constexpr uint16_t BANKS[] = {7 * 60, 9 * 60 + 30, 12 * 60 + 30, 16 * 60, 18 * 60 + 30, 21 * 60 + 30};
+
+      /**
+       * \brief Gates per terminal letter.
+       */
+      constexpr char TERMINALS[] = {'A', 'B', 'C', 'D'};
+      constexpr uint16_t TERMINAL_GATES[] = {30, 20, 40, 10};
+      const uint32_t GATE_COUNT = 100;
+
+      /**
+       * \brief Multiplier permuting the 10 000 numbers of a code; coprime with 10 000.
+       */
+      const uint32_t NUMBER_STRIDE = 3571;
+
+      template <size_t N>
+      constexpr bool totalIs (const Weighted (&p_table)[N])
+      {
+        uint32_t total = 0;
+        for (const Weighted& entry : p_table)
+          total += entry.m_weight;
+        return total == WEIGHT_TOTAL;
+      }
+      static_assert(totalIs(COMPANIES) && totalIs(CITIES) && totalIs(STATUSES));
+      static_assert(sizeof(COMPANIES) / sizeof(Weighted) == ScheduleGenerator::COMPANY_COUNT);
+
+      /**
+       * \brief Builds the table mapping a draw in [0, WEIGHT_TOTAL) to an entry index.
+       */
+      template <size_t N>
+      constexpr array<uint8_t, WEIGHT_TOTAL> makeLookup (const Weighted (&p_table)[N])
+      {
+        array<uint8_t, WEIGHT_TOTAL> lookup {};
+        uint32_t draw = 0;
+        for (size_t i = 0; i < N; ++i)
+          for (uint32_t j = 0; j < p_table[i].m_weight; ++j)
+            lookup[draw++] = static_cast<uint8_t>(i);
+        return lookup;
+      }
+
+      constexpr array<uint8_t, WEIGHT_TOTAL> COMPANY_LOOKUP = makeLookup(COMPANIES);
+      constexpr array<uint8_t, WEIGHT_TOTAL> CITY_LOOKUP = makeLookup(CITIES);
+      constexpr array<uint8_t, WEIGHT_TOTAL> STATUS_LOOKUP = makeLookup(STATUSES);
+
+      constexpr array<uint16_t, GATE_COUNT> makeGates ()
+      {
+        array<uint16_t, GATE_COUNT> gates {};
+        size_t i = 0;
+        for (size_t t = 0; t < 4; ++t)
+          for (uint16_t g = 1; g <= TERMINAL_GATES[t]; ++g)
+            gates[i++] = static_cast<uint16_t>((TERMINALS[t] << 8) | g);
+        return gates;
+      }
+
+      constexpr array<uint16_t, GATE_COUNT> GATES = makeGates();
+
+      constexpr uint16_t packCode (const char* p_code)
+      {
+        return static_cast<uint16_t>((p_code[0] << 8) | p_code[1]);
+      }
+
+      /**
+       * \brief Writes "HH:MM" at p_out.
+       */
+      char* writeHour (char* p_out, uint16_t p_minutes)
+      {
+        p_out[0] = static_cast<char>('0' + p_minutes / 600);
+        p_out[1] = static_cast<char>('0' + p_minutes / 60 % 10);
+        p_out[2] = ':';
+        p_out[3] = static_cast<char>('0' + p_minutes % 60 / 10);
+        p_out[4] = static_cast<char>('0' + p_minutes % 10);
+        return p_out + 5;
+      }
+
+      /**
+       * \brief Writes the six characters of a packed flight number at p_out.
+       */
+      char* writeNumber (char* p_out, uint32_t p_number)
+      {
+        uint32_t digits = p_number & 0xFFFF;
+        p_out[0] = static_cast<char>(p_number >> 24);
+        p_out[1] = static_cast<char>(p_number >> 16 & 0xFF);
+        p_out[2] = static_cast<char>('0' + digits / 1000);
+        p_out[3] = static_cast<char>('0' + digits / 100 % 10);
+        p_out[4] = static_cast<char>('0' + digits / 10 % 10);
+        p_out[5] = static_cast<char>('0' + digits % 10);
+        return p_out + 6;
+      }
+
+      /**
+       * \brief Writes the three characters of a packed gate at p_out.
+       */
+      char* writeGate (char* p_out, uint16_t p_gate)
+      {
+        p_out[0] = static_cast<char>(p_gate >> 8);
+        p_out[1] = static_cast<char>('0' + (p_gate & 0xFF) / 10);
+        p_out[2] = static_cast<char>('0' + (p_gate & 0xFF) % 10);
+        return p_out + 3;
+      }
+
+      char* writeText (char* p_out, const string& p_text)
+      {
+        return copy(p_text.begin(), p_text.end(), p_out);
+      }
+
+      char* writeText (char* p_out, const char* p_text)
+      {
+        while (*p_text)
+          *p_out++ = *p_text++;
+        return p_out;
+      }
+
+      /**
+       * \brief Appends the CSV row of a flight, newline included; at most 64 bytes.
+       */
+      char* writeRow (char* p_out, const ScheduledFlight& p_flight)
+      {
+        *p_out++ = p_flight.m_arrival ? 'A' : 'D';
+        *p_out++ = ',';
+        p_out = writeNumber(p_out, p_flight.m_number);
+        *p_out++ = ',';
+        p_out = writeText(p_out, COMPANIES[p_flight.m_company].m_name);
+        *p_out++ = ',';
+        p_out = writeHour(p_out, p_flight.m_hour);
+        *p_out++ = ',';
+        p_out = writeText(p_out, CITIES[p_flight.m_city].m_name);
+        *p_out++ = ',';
+        if (p_flight.m_arrival)
+          {
+            p_out = writeText(p_out, statusText(p_flight.m_status));
+            *p_out++ = ',';
+          }
+        else
+          {
+            p_out = writeHour(p_out, p_flight.m_boarding);
+            *p_out++ = ',';
+            p_out = writeGate(p_out, p_flight.m_gate);
+          }
+        *p_out++ = '\n';
+        return p_out;
+      }
+
+      void putLittleEndian (char* p_out, uint64_t p_value, size_t p_bytes)
+      {
+        for (size_t i = 0; i < p_bytes; ++i)
+          p_out[i] = static_cast<char>(p_value >> (8 * i));
+      }
+
+      uint64_t getLittleEndian (const char* p_in, size_t p_bytes)
+      {
+        uint64_t value = 0;
+        for (size_t i = 0; i < p_bytes; ++i)
+          value |= static_cast<uint64_t>(static_cast<unsigned char>(p_in[i])) << (8 * i);
+        return value;
+      }
+
+      const size_t BATCH = 4096;
+    }
+
+    /**
+     * \brief Constructor of the ScheduleGenerator class.
+     *
+     * \param[in] p_seed The seed; two generators with the same seed produce the same flights.
+     */
+    ScheduleGenerator::ScheduleGenerator (uint64_t p_seed): m_state(p_seed), m_generated(0),
+        m_nextSpareCode(0), m_slotUse()
+    {
+      for (size_t i = 0; i < COMPANY_COUNT; ++i)
+        {
+          m_codes[i] = packCode(COMPANIES[i].m_code);
+          m_counters[i] = 0;
+          m_offsets[i] = static_cast<uint16_t>(random() % 10000);
+        }
+    }
+
+    /**
+     * \brief splitmix64 step.
+     */
+    uint64_t ScheduleGenerator::random ()
+    {
+      uint64_t z = (m_state += 0x9E3779B97F4A7C15ull);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+
+    /**
+     * \brief Moves a company whose code is used up to the next spare code.
+     *
+     * \return false when no spare code is left.
+     */
+    bool ScheduleGenerator::takeSpareCode (uint8_t p_company)
+    {
+      while (m_nextSpareCode < 26 * 26)
+        {
+          uint16_t code = static_cast<uint16_t>((('A' + m_nextSpareCode / 26) << 8) | ('A' + m_nextSpareCode % 26));
+          ++m_nextSpareCode;
+          bool taken = false;
+          for (const Weighted& company : COMPANIES)
+            taken |= packCode(company.m_code) == code;
+          if (!taken)
+            {
+              m_codes[p_company] = code;
+              m_counters[p_company] = 0;
+              return true;
+            }
+        }
+      return false;
+    }
+
+    /**
+     * \brief Hands out the next unused flight number of a company.
+     */
+    uint32_t ScheduleGenerator::nextNumber (uint8_t p_company)
+    {
+      uint32_t counter = m_counters[p_company]++;
+      uint32_t digits = (counter * NUMBER_STRIDE + m_offsets[p_company]) % 10000;
+      return (static_cast<uint32_t>(m_codes[p_company]) << 16) | digits;
+    }
+
+    /**
+     * \brief Generates the next flight.
+     *
+     * \pre Less than MAX_FLIGHTS flights have been generated.
+     * \return The flight, valid for its kind.
+     */
+    ScheduledFlight ScheduleGenerator::next ()
+    {
+      PRECONDITION(m_generated < MAX_FLIGHTS);
+      uint64_t bits = random();
+      ScheduledFlight flight;
+      flight.m_company = COMPANY_LOOKUP[bits % WEIGHT_TOTAL];
+      flight.m_city = CITY_LOOKUP[(bits >> 10) % WEIGHT_TOTAL];
+      flight.m_arrival = (bits >> 20) & 1;
+      flight.m_status = STATUS_VALUES[STATUS_LOOKUP[(bits >> 21) % WEIGHT_TOTAL]];
+
+      // 85 % of the flights leave within an hour of a bank, the others at any time
+      uint64_t timeBits = random();
+      uint32_t hour;
+      if (timeBits % 100 < 85)
+        {
+          uint32_t bank = BANKS[(timeBits >> 8) % 6];
+          hour = bank + (timeBits >> 16) % 61 + (timeBits >> 24) % 61 - 60;
+        }
+      else
+        {
+          hour = (timeBits >> 8) % (24 * 60);
+        }
+      flight.m_hour = static_cast<uint16_t>(hour / 5 * 5);
+      uint32_t lead = 30 + 5 * ((timeBits >> 32) % 4);
+      flight.m_boarding = static_cast<uint16_t>((flight.m_hour + 24 * 60 - lead) % (24 * 60));
+
+      // the gates of a half-hour slot are handed out in turn, from a slot-dependent start
+      uint32_t slot = flight.m_hour / 30;
+      flight.m_gate = GATES[(m_slotUse[slot]++ + slot * 37) % GATE_COUNT];
+
+      if (m_counters[flight.m_company] == 10000 && !takeSpareCode(flight.m_company))
+        {
+          // every spare code is used: borrow the first company with numbers left
+          uint8_t company = 0;
+          while (m_counters[company] == 10000)
+            ++company;
+          flight.m_company = company;
+        }
+      flight.m_number = nextNumber(flight.m_company);
+      ++m_generated;
+      return flight;
+    }
+
+    /**
+     * \brief Generates p_count flights into p_flights.
+     */
+    void ScheduleGenerator::generate (ScheduledFlight* p_flights, size_t p_count)
+    {
+      for (size_t i = 0; i < p_count; ++i)
+        p_flights[i] = next();
+    }
+
+    /**
+     * \brief Returns the number of flights generated so far.
+     */
+    size_t ScheduleGenerator::getGeneratedCount () const
+    {
+      return m_generated;
+    }
+
+    /**
+     * \brief Generates p_count flights and adds them to an airport.
+     *
+     * \param[in] p_airport The airport receiving the flights.
+     * \param[in] p_count The number of flights to generate.
+     * \return The number of flights added; flights already in the airport are skipped.
+     */
+    size_t ScheduleGenerator::fill (Airport& p_airport, size_t p_count)
+    {
+      size_t added = 0;
+      vector<unique_ptr<Flight>> flights;
+      vector<const Flight*> pointers;
+      while (p_count > 0)
+        {
+          size_t batch = min(p_count, BATCH * 16);
+          flights.clear();
+          pointers.clear();
+          for (size_t i = 0; i < batch; ++i)
+            {
+              flights.push_back(makeFlight(next()));
+              pointers.push_back(flights.back().get());
+            }
+          for (FlightResult result : p_airport.tryAddFlights(pointers))
+            added += result == FlightResult::Ok;
+          p_count -= batch;
+        }
+      return added;
+    }
+
+    /**
+     * \brief Generates p_count flights and writes them as CSV, after a header line.
+     *
+     * A row is "D,number,company,hour,city,boarding,gate" for a departure and
+     * "A,number,company,hour,city,status," for an arrival.
+     */
+    void ScheduleGenerator::writeCsv (ostream& p_os, size_t p_count)
+    {
+      p_os << "type,number,company,hour,city,boarding_or_status,gate\n";
+      vector<char> buffer(BATCH * 64);
+      while (p_count > 0)
+        {
+          size_t batch = min(p_count, BATCH);
+          char* out = buffer.data();
+          for (size_t i = 0; i < batch; ++i)
+            out = writeRow(out, next());
+          p_os.write(buffer.data(), out - buffer.data());
+          p_count -= batch;
+        }
+    }
+
+    /**
+     * \brief Generates p_count flights and writes them in the binary schedule format.
+     *
+     * The format is a BINARY_HEADER_SIZE header ("FMSB", a 32-bit version 1 and
+     * the 64-bit flight count) followed by one BINARY_RECORD_SIZE record per
+     * flight, as encode() writes it; all integers are little-endian.
+     */
+    void ScheduleGenerator::writeBinary (ostream& p_os, size_t p_count)
+    {
+      char header[BINARY_HEADER_SIZE] = {'F', 'M', 'S', 'B'};
+      putLittleEndian(header + 4, 1, 4);
+      putLittleEndian(header + 8, p_count, 8);
+      p_os.write(header, BINARY_HEADER_SIZE);
+      vector<char> buffer(BATCH * BINARY_RECORD_SIZE);
+      while (p_count > 0)
+        {
+          size_t batch = min(p_count, BATCH);
+          for (size_t i = 0; i < batch; ++i)
+            encode(next(), buffer.data() + i * BINARY_RECORD_SIZE);
+          p_os.write(buffer.data(), batch * BINARY_RECORD_SIZE);
+          p_count -= batch;
+        }
+    }
+
+    /**
+     * \brief Builds the Depart or the Arrival described by a generated flight.
+     */
+    unique_ptr<Flight> ScheduleGenerator::makeFlight (const ScheduledFlight& p_flight)
+    {
+      char number[6], hour[5];
+      writeNumber(number, p_flight.m_number);
+      writeHour(hour, p_flight.m_hour);
+      if (p_flight.m_arrival)
+        {
+          return make_unique<Arrival>(string(number, 6), COMPANIES[p_flight.m_company].m_name,
+                                      string(hour, 5), CITIES[p_flight.m_city].m_name,
+                                      statusText(p_flight.m_status));
+        }
+      char boarding[5], gate[3];
+      writeHour(boarding, p_flight.m_boarding);
+      writeGate(gate, p_flight.m_gate);
+      return make_unique<Depart>(string(number, 6), COMPANIES[p_flight.m_company].m_name,
+                                 string(hour, 5), CITIES[p_flight.m_city].m_name,
+                                 string(boarding, 5), string(gate, 3));
+    }
+
+    /**
+     * \brief Returns the CSV row writeCsv() writes for a flight, newline included.
+     */
+    string ScheduleGenerator::csvRow (const ScheduledFlight& p_flight)
+    {
+      char row[64];
+      return string(row, writeRow(row, p_flight));
+    }
+
+    /**
+     * \brief Encodes a flight into a BINARY_RECORD_SIZE record.
+     *
+     * Layout: number (4 bytes), hour, boarding and gate (2 bytes each), company,
+     * city, kind (0 departure, 1 arrival) and status (1 byte each), 2 zero bytes.
+     */
+    void ScheduleGenerator::encode (const ScheduledFlight& p_flight, char* p_record)
+    {
+      putLittleEndian(p_record, p_flight.m_number, 4);
+      putLittleEndian(p_record + 4, p_flight.m_hour, 2);
+      putLittleEndian(p_record + 6, p_flight.m_boarding, 2);
+      putLittleEndian(p_record + 8, p_flight.m_gate, 2);
+      p_record[10] = static_cast<char>(p_flight.m_company);
+      p_record[11] = static_cast<char>(p_flight.m_city);
+      p_record[12] = p_flight.m_arrival ? 1 : 0;
+      p_record[13] = static_cast<char>(p_flight.m_status);
+      p_record[14] = 0;
+      p_record[15] = 0;
+    }
+
+    /**
+     * \brief Decodes a record written by encode().
+     */
+    ScheduledFlight ScheduleGenerator::decode (const char* p_record)
+    {
+      ScheduledFlight flight;
+      flight.m_number = static_cast<uint32_t>(getLittleEndian(p_record, 4));
+      flight.m_hour = static_cast<uint16_t>(getLittleEndian(p_record + 4, 2));
+      flight.m_boarding = static_cast<uint16_t>(getLittleEndian(p_record + 6, 2));
+      flight.m_gate = static_cast<uint16_t>(getLittleEndian(p_record + 8, 2));
+      flight.m_company = static_cast<uint8_t>(p_record[10]);
+      flight.m_city = static_cast<uint8_t>(p_record[11]);
+      flight.m_arrival = p_record[12] != 0;
+      flight.m_status = static_cast<ArrivalStatus>(p_record[13]);
+      return flight;
+    }
+
+    const char* ScheduleGenerator::companyName (uint8_t p_company)
+    {
+      return COMPANIES[p_company].m_name;
+    }
+
+    const char* ScheduleGenerator::cityName (uint8_t p_city)
+    {
+      return CITIES[p_city].m_name;
+    }
+
+}
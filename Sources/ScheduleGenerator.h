@@ -0,0 +1,94 @@
+/**
+ \file ScheduleGenerator.h
+ \brief File containing the declaration of the ScheduleGenerator class
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef SCHEDULEGENERATOR_H
+#define SCHEDULEGENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include "Airport.h"
+#include "Arrival.h"
+
+namespace aerien
+{
+  /**
+   * \struct ScheduledFlight
+   * \brief Compact form of a generated flight.
+   *
+   * The number and the gate are packed as util::parseNumber and util::parseGate
+   * pack them; the hours are minutes after midnight. m_boarding and m_gate are
+   * only meaningful for a departure, m_status for an arrival.
+   */
+  struct ScheduledFlight
+  {
+    std::uint32_t m_number;
+    std::uint16_t m_hour;
+    std::uint16_t m_boarding;
+    std::uint16_t m_gate;
+    std::uint8_t m_company;
+    std::uint8_t m_city;
+    bool m_arrival;
+    ArrivalStatus m_status;
+  };
+
+  /**
+   * \class ScheduleGenerator
+   * \brief Deterministic generator of valid Depart and Arrival populations.
+   *
+   * Companies and cities are drawn from weighted tables, hours cluster around
+   * the departure banks of a hub, the gates of a half-hour slot are handed out
+   * in turn so they are reused from one slot to the next, and arrivals mix
+   * the three statuses. Flight numbers are unique: each company numbers its
+   * flights under its own code, then under spare codes once its 10 000
+   * numbers are used.
+   *
+   * The generator only uses integer arithmetic on its own random engine, so a
+   * seed produces the same schedule on every platform.
+   */
+  class ScheduleGenerator
+  {
+  public:
+    static const std::size_t COMPANY_COUNT = 17;
+    static const std::size_t MAX_FLIGHTS = 26 * 26 * 10000;
+    static const std::size_t BINARY_HEADER_SIZE = 16;
+    static const std::size_t BINARY_RECORD_SIZE = 16;
+
+    explicit ScheduleGenerator (std::uint64_t p_seed);
+
+    ScheduledFlight next ();
+    void generate (ScheduledFlight* p_flights, std::size_t p_count);
+    std::size_t getGeneratedCount () const;
+
+    std::size_t fill (Airport& p_airport, std::size_t p_count);
+    void writeCsv (std::ostream& p_os, std::size_t p_count);
+    void writeBinary (std::ostream& p_os, std::size_t p_count);
+
+    static std::unique_ptr<Flight> makeFlight (const ScheduledFlight& p_flight);
+    static std::string csvRow (const ScheduledFlight& p_flight);
+    static void encode (const ScheduledFlight& p_flight, char* p_record);
+    static ScheduledFlight decode (const char* p_record);
+    static const char* companyName (std::uint8_t p_company);
+    static const char* cityName (std::uint8_t p_city);
+
+  private:
+    std::uint64_t random ();
+    std::uint32_t nextNumber (std::uint8_t p_company);
+    bool takeSpareCode (std::uint8_t p_company);
+
+    std::uint64_t m_state;
+    std::size_t m_generated;
+    std::uint16_t m_codes[COMPANY_COUNT];
+    std::uint16_t m_counters[COMPANY_COUNT];
+    std::uint16_t m_offsets[COMPANY_COUNT];
+    std::uint16_t m_nextSpareCode;
+    std::uint32_t m_slotUse[48];
+  };
+}
+
+#endif /* SCHEDULEGENERATOR_H */
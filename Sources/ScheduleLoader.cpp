@@ -0,0 +1,247 @@
+/**
+ * \file   ScheduleLoader.cpp
+ * \brief  File containing the implementation of the ScheduleLoader class
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "ScheduleLoader.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "trace.h"
+#include "validationFormat.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aerien{
+    using namespace std;
+
+    namespace
+    {
+      const size_t FIELD_COUNT = 7;
+
+      /**
+       * \brief Splits a CSV row on its commas.
+       * \return The number of fields, or FIELD_COUNT + 1 if there are too many.
+       */
+      size_t splitRow (string_view p_row, string_view* p_fields)
+      {
+        size_t count = 0;
+        while (count <= FIELD_COUNT)
+          {
+            size_t comma = p_row.find(',');
+            if (count == FIELD_COUNT)
+              {
+                return count + 1;
+              }
+            p_fields[count++] = p_row.substr(0, comma);
+            if (comma == string_view::npos)
+              {
+                return count;
+              }
+            p_row.remove_prefix(comma + 1);
+          }
+        return count;
+      }
+    }
+
+    /**
+     * \brief Constructor of the ScheduleLoader class, without progress callback.
+     */
+    ScheduleLoader::ScheduleLoader (): m_cancelled(false)
+    {
+    }
+
+    /**
+     * \brief Sets the callback called after each batch.
+     *
+     * \param[in] p_progress The callback; it runs on the loading thread.
+     */
+    void ScheduleLoader::setProgress (Progress p_progress)
+    {
+      m_progress = move(p_progress);
+    }
+
+    /**
+     * \brief Asks the loading to stop after its current batch; may be called from any thread.
+     */
+    void ScheduleLoader::cancel ()
+    {
+      m_cancelled.store(true);
+    }
+
+    /**
+     * \brief Returns true if cancel() was called.
+     */
+    bool ScheduleLoader::isCancelled () const
+    {
+      return m_cancelled.load();
+    }
+
+    /**
+     * \brief Loads a CSV schedule into an airport.
+     *
+     * An optional first line starting with "type," is skipped, as are the
+     * blank lines. The invalid rows and the duplicate flight numbers are
+     * counted, not thrown.
+     *
+     * \param[in,out] p_is The stream of the schedule.
+     * \param[in,out] p_airport The airport the flights are added to.
+     * \return The counts of the rows read, added and rejected.
+     */
+    LoadReport ScheduleLoader::loadCsv (istream& p_is, Airport& p_airport)
+    {
+      TRACE_SPAN("ScheduleLoader::loadCsv");
+      LoadReport report;
+      vector<unique_ptr<Flight>> batch;
+      vector<const Flight*> pointers;
+      batch.reserve(BATCH_ROWS);
+      pointers.reserve(BATCH_ROWS);
+      size_t bytes = 0;
+      string line;
+      bool first = true;
+      bool more = true;
+      while (more)
+        {
+          size_t read = 0;
+          while (read < BATCH_ROWS && (more = static_cast<bool>(getline(p_is, line))))
+            {
+              bytes += line.size() + 1;
+              if (!line.empty() && line.back() == '\r')
+                {
+                  line.pop_back();
+                }
+              if (line.empty() || (first && line.compare(0, 5, "type,") == 0))
+                {
+                  first = false;
+                  continue;
+                }
+              first = false;
+              ++read;
+              unique_ptr<Flight> flight = parseRow(line);
+              if (flight)
+                {
+                  pointers.push_back(flight.get());
+                  batch.push_back(move(flight));
+                }
+              else
+                {
+                  ++report.m_invalid;
+                }
+            }
+          report.m_rows += read;
+          if (!pointers.empty())
+            {
+              TRACE_SPAN("ScheduleLoader batch");
+              for (FlightResult result : p_airport.tryAddFlights(pointers))
+                {
+                  if (result == FlightResult::Ok)
+                    {
+                      ++report.m_added;
+                    }
+                  else
+                    {
+                      ++report.m_duplicates;
+                    }
+                }
+              batch.clear();
+              pointers.clear();
+            }
+          if (m_progress)
+            {
+              m_progress(bytes, report.m_rows);
+            }
+          if (more && m_cancelled.load())
+            {
+              report.m_cancelled = true;
+              break;
+            }
+        }
+      return report;
+    }
+
+    /**
+     * \brief Builds the flight of a row, or returns nullptr if a field is invalid.
+     *
+     * A row is "D,number,company,hour,city,boarding,gate" for a departure and
+     * "A,number,company,hour,city,status," for an arrival.
+     *
+     * \param[in] p_row The row, without its end of line.
+     * \return The flight, or nullptr.
+     */
+    unique_ptr<Flight> ScheduleLoader::parseRow (string_view p_row)
+    {
+      string_view fields[FIELD_COUNT];
+      size_t count = splitRow(p_row, fields);
+      if (count < 6 || count > FIELD_COUNT || fields[0].size() != 1
+          || !util::isValidNumber(fields[1]) || !util::isValidName(fields[2])
+          || !util::isValid24Format(fields[3]) || !util::isValidName(fields[4]))
+        {
+          return nullptr;
+        }
+      if (fields[0][0] == 'A')
+        {
+          if (!util::isValidStatus(fields[5]) || (count == FIELD_COUNT && !fields[6].empty()))
+            {
+              return nullptr;
+            }
+          return make_unique<Arrival>(string(fields[1]), string(fields[2]), string(fields[3]),
+                                      string(fields[4]), string(fields[5]));
+        }
+      if (fields[0][0] != 'D' || count != FIELD_COUNT || !util::isValid24Format(fields[5])
+          || !util::isValidGate(fields[6]))
+        {
+          return nullptr;
+        }
+      return make_unique<Depart>(string(fields[1]), string(fields[2]), string(fields[3]),
+                                 string(fields[4]), string(fields[5]), string(fields[6]));
+    }
+
+    /**
+     * \brief Writes a board as a CSV schedule loadCsv() reads back.
+     *
+     * The flights are written in the order of the board, after the header
+     * line of ScheduleGenerator::writeCsv, by blocks of BATCH_ROWS rows.
+     *
+     * \param[out] p_os The stream written.
+     * \param[in] p_board The board to write.
+     */
+    void ScheduleLoader::writeCsv (ostream& p_os, const Airport::Board& p_board)
+    {
+      TRACE_SPAN("ScheduleLoader::writeCsv");
+      p_os << "type,number,company,hour,city,boarding_or_status,gate\n";
+      string rows;
+      rows.reserve(BATCH_ROWS * 64);
+      for (size_t i = 0; i < p_board.m_flights.size(); ++i)
+        {
+          const Flight& flight = *p_board.m_flights[i];
+          const Depart* depart = dynamic_cast<const Depart*>(&flight);
+          rows += depart != nullptr ? "D," : "A,";
+          for (string_view field : {flight.getNumberView(), flight.getCompanyView(), flight.getHourView(), flight.getCityView()})
+            {
+              rows += field;
+              rows += ',';
+            }
+          if (depart != nullptr)
+            {
+              rows += depart->getBoardingHourView();
+              rows += ',';
+              rows += depart->getBoardingGateView();
+            }
+          else if (const Arrival* arrival = dynamic_cast<const Arrival*>(&flight))
+            {
+              rows += arrival->getStatus();
+              rows += ',';
+            }
+          rows += '\n';
+          if ((i + 1) % BATCH_ROWS == 0)
+            {
+              p_os << rows;
+              rows.clear();
+            }
+        }
+      p_os << rows;
+    }
+}
@@ -0,0 +1,71 @@
+/**
+ \file ScheduleLoader.h
+ \brief File containing the declaration of the ScheduleLoader class
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef SCHEDULELOADER_H
+#define SCHEDULELOADER_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string_view>
+#include "Airport.h"
+
+namespace aerien
+{
+  /**
+   * \struct LoadReport
+   * \brief Outcome of the loading of a schedule.
+   */
+  struct LoadReport
+  {
+    std::size_t m_rows = 0;        ///< Data rows read, header excluded.
+    std::size_t m_added = 0;       ///< Flights added to the airport.
+    std::size_t m_duplicates = 0;  ///< Rows whose flight number was already listed.
+    std::size_t m_invalid = 0;     ///< Rows rejected by the validators.
+    bool m_cancelled = false;      ///< True if the loading stopped on cancel().
+  };
+
+  /**
+   * \class ScheduleLoader
+   * \brief Loads the CSV schedules written by ScheduleGenerator::writeCsv into an Airport.
+   *
+   * The rows are parsed and validated without throwing, then inserted by
+   * batches of BATCH_ROWS with Airport::tryAddFlights. After each batch the
+   * progress callback is called, on the loading thread, and the loading stops
+   * if cancel() was called meanwhile, from any thread; the flights of the
+   * batches already inserted stay in the airport. writeCsv() writes a board
+   * back in the same format.
+   */
+  class ScheduleLoader
+  {
+  public:
+    /**
+     * \brief Called after each batch with the bytes and the rows read so far.
+     */
+    typedef std::function<void (std::size_t p_bytes, std::size_t p_rows)> Progress;
+
+    static const std::size_t BATCH_ROWS = 4096;
+
+    ScheduleLoader ();
+
+    void setProgress (Progress p_progress);
+    void cancel ();
+    bool isCancelled () const;
+    LoadReport loadCsv (std::istream& p_is, Airport& p_airport);
+
+    static std::unique_ptr<Flight> parseRow (std::string_view p_row);
+    static void writeCsv (std::ostream& p_os, const Airport::Board& p_board);
+
+  private:
+    Progress m_progress;
+    std::atomic<bool> m_cancelled;
+  };
+}
+
+#endif /* SCHEDULELOADER_H */
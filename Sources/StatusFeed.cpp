@@ -0,0 +1,136 @@
+/**
+ * \file   StatusFeed.cpp
+ * \brief  File containing the implementation of the StatusFeed class
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+
+#include "StatusFeed.h"
+#include "validationFormat.h"
+#include "trace.h"
+#include <chrono>
+
+namespace aerien{
+    using namespace std;
+
+    /**
+     * \brief Constructor of the StatusFeed class; starts the applier thread.
+     *
+     * \param[in] p_airport The airport receiving the status changes; it must outlive the feed.
+     * \param[in] p_capacity The number of pending records the queue holds.
+     * \param[in] p_batchSize The maximum number of records applied together.
+     */
+    StatusFeed::StatusFeed (Airport& p_airport, size_t p_capacity, size_t p_batchSize):
+        m_airport(p_airport), m_queue(p_capacity), m_batchSize(p_batchSize == 0 ? 1 : p_batchSize),
+        m_drained(0), m_applied(0), m_stop(false)
+    {
+      m_applier = thread(&StatusFeed::run, this);
+    }
+
+    /**
+     * \brief Destructor: the records already posted are applied, then the applier stops.
+     */
+    StatusFeed::~StatusFeed ()
+    {
+      m_stop.store(true, memory_order_release);
+      m_applier.join();
+    }
+
+    /**
+     * \brief Posts a status change.
+     *
+     * \param[in] p_number The flight number of the arrival.
+     * \param[in] p_status The new status.
+     * \return false if the number is invalid or the queue is full.
+     */
+    bool StatusFeed::post (const string& p_number, ArrivalStatus p_status)
+    {
+      uint32_t key;
+      return util::parseNumber(p_number, key) && post(key, p_status);
+    }
+
+    /**
+     * \brief Posts a status change of an already packed flight number.
+     *
+     * \param[in] p_number The flight number packed by util::parseNumber.
+     * \param[in] p_status The new status.
+     * \return false if the queue is full.
+     */
+    bool StatusFeed::post (uint32_t p_number, ArrivalStatus p_status)
+    {
+      return m_queue.tryPush(StatusUpdate{p_number, p_status});
+    }
+
+    /**
+     * \brief Waits until every record posted before the call has been applied.
+     */
+    void StatusFeed::flush ()
+    {
+      uint64_t target = m_queue.pushedCount();
+      unique_lock<mutex> lock(m_drainMutex);
+      m_drainedCondition.wait(lock, [this, target] { return m_drained.load(memory_order_acquire) >= target; });
+    }
+
+    /**
+     * \brief Returns the number of status changes applied to the airport so far.
+     */
+    uint64_t StatusFeed::getAppliedCount () const
+    {
+      return m_applied.load(memory_order_acquire);
+    }
+
+    /**
+     * \brief Loop of the applier thread.
+     *
+     * When the queue is empty it yields for a while, then sleeps 100 us between
+     * polls, so the producers never have to wake it up. Once stopped, it
+     * returns when the records of every position claimed by a producer have
+     * been applied.
+     */
+    void StatusFeed::run ()
+    {
+      util::setTraceThreadName("status feed");
+      vector<StatusUpdate> batch;
+      batch.reserve(m_batchSize);
+      int idle = 0;
+      for (;;)
+        {
+          StatusUpdate update;
+          while (batch.size() < m_batchSize && m_queue.tryPop(update))
+            {
+              batch.push_back(update);
+            }
+          if (!batch.empty())
+            {
+              m_applied.fetch_add(m_airport.applyStatusUpdates(batch.data(), batch.size()),
+                                  memory_order_release);
+              {
+                // Counted under the lock, so a flush() about to wait cannot miss the notification
+                lock_guard<mutex> lock(m_drainMutex);
+                m_drained.fetch_add(batch.size(), memory_order_release);
+              }
+              m_drainedCondition.notify_all();
+              batch.clear();
+              idle = 0;
+            }
+          else if (m_stop.load(memory_order_acquire))
+            {
+              // A producer may have claimed a position without having written
+              // its record yet: stop only once every claimed record is drained
+              if (m_drained.load(memory_order_relaxed) == m_queue.pushedCount())
+                {
+                  break;
+                }
+              this_thread::yield();
+            }
+          else if (++idle < 64)
+            {
+              this_thread::yield();
+            }
+          else
+            {
+              this_thread::sleep_for(chrono::microseconds(100));
+            }
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/**
+ \file StatusFeed.h
+ \brief File containing the declaration of the StatusFeed class
+ * \author Chih Taki-eddine
+ * \date October 18, 2026
+ */
+#ifndef STATUSFEED_H
+#define STATUSFEED_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Airport.h"
+#include "mpscQueue.h"
+
+namespace aerien
+{
+  /**
+   * \class StatusFeed
+   * \brief Collects the arrival status changes of several feeds and applies them to an Airport.
+   *
+   * The feeds post compact records into a lock-free queue and return at once.
+   * A dedicated applier thread drains the queue by batches; each batch is a
+   * single mutation of the airport, published with the other pending ones.
+   */
+  class StatusFeed
+  {
+  public:
+    StatusFeed (Airport& p_airport, std::size_t p_capacity = 4096, std::size_t p_batchSize = 256);
+    ~StatusFeed ();
+    StatusFeed (const StatusFeed&) = delete;
+    StatusFeed& operator= (const StatusFeed&) = delete;
+
+    bool post (const std::string& p_number, ArrivalStatus p_status);
+    bool post (std::uint32_t p_number, ArrivalStatus p_status);
+    void flush ();
+    std::uint64_t getAppliedCount () const;
+
+  private:
+    void run ();
+
+    Airport& m_airport;
+    util::MpscQueue<StatusUpdate> m_queue;
+    std::size_t m_batchSize;
+    std::atomic<std::uint64_t> m_drained;  ///< Records taken from the queue and applied.
+    std::mutex m_drainMutex;
+    std::condition_variable m_drainedCondition;  ///< Notified after each batch, for flush().
+    std::atomic<std::uint64_t> m_applied;
+    std::atomic<bool> m_stop;
+    std::thread m_applier;
+  };
+}
+
+#endif /* STATUSFEED_H */
@@ -0,0 +1,61 @@
+/**
+ * \file arenaResource.cpp
+ * \brief Implementation of the thread-safe monotonic memory resource
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ */
+
+#include "arenaResource.h"
+
+namespace util {
+
+/**
+ * \brief Constructor of an empty arena.
+ * \param[in] p_initialSize The size of the first block taken from p_upstream;
+ *            the following blocks grow geometrically.
+ * \param[in] p_upstream The resource the blocks are taken from.
+ */
+ArenaResource::ArenaResource(std::size_t p_initialSize, std::pmr::memory_resource* p_upstream)
+  : m_arena(p_initialSize, p_upstream), m_allocated(0)
+{
+}
+
+/**
+ * \brief Gives all the blocks back to the upstream resource.
+ *
+ * Every object allocated from the arena must have been destroyed, or be
+ * trivially destructible.
+ */
+void ArenaResource::release()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_arena.release();
+  m_allocated = 0;
+}
+
+/**
+ * \brief Returns the number of bytes allocated since the last release.
+ */
+std::size_t ArenaResource::getAllocatedBytes() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_allocated;
+}
+
+void* ArenaResource::do_allocate(std::size_t p_bytes, std::size_t p_alignment)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_allocated += p_bytes;
+  return m_arena.allocate(p_bytes, p_alignment);
+}
+
+void ArenaResource::do_deallocate(void*, std::size_t, std::size_t)
+{
+}
+
+bool ArenaResource::do_is_equal(const std::pmr::memory_resource& p_other) const noexcept
+{
+  return this == &p_other;
+}
+
+}
@@ -0,0 +1,53 @@
+/**
+ * \file arenaResource.h
+ * \brief Thread-safe monotonic memory resource for the flights of a day-scoped board
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ */
+
+#ifndef ARENARESOURCE_H
+#define ARENARESOURCE_H
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace util {
+
+/**
+ * \class ArenaResource
+ * \brief std::pmr::monotonic_buffer_resource behind a mutex.
+ *
+ * An allocation moves a pointer in the current block; deallocating does
+ * nothing, and release() gives all the blocks back to the upstream resource
+ * at once. An Airport fills its shards from several threads and its readers
+ * release old flights from theirs, so its resource must be thread-safe,
+ * which the standard monotonic resource is not.
+ *
+ * The memory is only reclaimed by release() or by the destructor: an arena
+ * suits a board loaded once and dropped as a whole, not one rewritten all
+ * day by status updates (see std::pmr::synchronized_pool_resource).
+ */
+class ArenaResource : public std::pmr::memory_resource
+{
+public:
+  explicit ArenaResource(std::size_t p_initialSize = 64 * 1024,
+                         std::pmr::memory_resource* p_upstream = std::pmr::new_delete_resource());
+  ArenaResource(const ArenaResource&) = delete;
+  ArenaResource& operator=(const ArenaResource&) = delete;
+
+  void release();
+  std::size_t getAllocatedBytes() const;
+
+private:
+  void* do_allocate(std::size_t p_bytes, std::size_t p_alignment) override;
+  void do_deallocate(void* p_pointer, std::size_t p_bytes, std::size_t p_alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override;
+
+  mutable std::mutex m_mutex;
+  std::pmr::monotonic_buffer_resource m_arena;
+  std::size_t m_allocated;
+};
+
+}
+
+#endif /* ARENARESOURCE_H */
@@ -0,0 +1,355 @@
+/**
+ * \file   batchValidation.cpp
+ * \brief  Definition of the columnar batch validators for the Aerien project.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ *
+ * A column holds p_count fixed-width records stored back to back. Blocks of
+ * 32 records (AVX2) or 16 records (SSE4.2) are exactly p_width vectors long,
+ * so every vector of a block sees the same lane pattern and is checked with a
+ * handful of compare instructions. The per-byte results are turned into a bit
+ * stream with movemask and folded into one validity bit per record; the records
+ * that do not fill a whole block go through the scalar validators.
+ */
+#include "batchValidation.h"
+#include "validationFormat.h"
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BATCH_VALIDATION_X86 1
+#endif
+
+namespace util {
+    using namespace std;
+
+    namespace
+    {
+      const size_t MAX_WIDTH = 6;
+
+      /**
+       * \brief Byte-level description of a fixed-width field.
+       *
+       * Lane j of a record must lie in [low[j], high[j]]. Two extra ranges, A and B,
+       * describe what a lane-wise check cannot: with a pair rule a record is invalid
+       * when lane j is in A and lane j+1 is in B (a "2" followed by "4"-"9" in an hour,
+       * a "0" followed by "0" in a gate); without it any lane in A or B is invalid.
+       * An empty range is written low = 1, high = 0.
+       */
+      struct FieldRule
+      {
+        size_t width;
+        unsigned char low[MAX_WIDTH];
+        unsigned char high[MAX_WIDTH];
+        unsigned char aLow[MAX_WIDTH];
+        unsigned char aHigh[MAX_WIDTH];
+        unsigned char bLow[MAX_WIDTH];
+        unsigned char bHigh[MAX_WIDTH];
+        bool pairRule;
+        bool (*scalar)(const char* p_field);
+      };
+
+      bool scalarNumber(const char* p_field)
+      {
+        uint32_t packed;
+        return parseNumber(p_field, NUMBER_WIDTH, packed);
+      }
+
+      bool scalarHour(const char* p_field)
+      {
+        uint16_t minutes;
+        return parse24Format(p_field, HOUR_WIDTH, minutes);
+      }
+
+      bool scalarGate(const char* p_field)
+      {
+        uint16_t packed;
+        return parseGate(p_field, GATE_WIDTH, packed);
+      }
+
+      // Same rule as isValideCode(): no lowercase letter and no digit.
+      bool scalarCode(const char* p_field)
+      {
+        for (size_t i = 0; i < CODE_WIDTH; ++i)
+          {
+            unsigned char c = static_cast<unsigned char>(p_field[i]);
+            if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))
+              return false;
+          }
+        return true;
+      }
+
+      const FieldRule NUMBER_RULE = {
+        NUMBER_WIDTH,
+        {'A', 'A', '0', '0', '0', '0'}, {'Z', 'Z', '9', '9', '9', '9'},
+        {1, 1, 1, 1, 1, 1}, {0, 0, 0, 0, 0, 0},
+        {1, 1, 1, 1, 1, 1}, {0, 0, 0, 0, 0, 0},
+        true, scalarNumber
+      };
+
+      const FieldRule HOUR_RULE = {
+        HOUR_WIDTH,
+        {'0', '0', ':', '0', '0'}, {'2', '9', ':', '5', '9'},
+        {'2', 1, 1, 1, 1}, {'2', 0, 0, 0, 0},
+        {1, '4', 1, 1, 1}, {0, 0xFF, 0, 0, 0},
+        true, scalarHour
+      };
+
+      const FieldRule GATE_RULE = {
+        GATE_WIDTH,
+        {'A', '0', '0'}, {'Z', '9', '9'},
+        {1, '0', 1}, {0, '0', 0},
+        {1, 1, '0'}, {0, 0, '0'},
+        true, scalarGate
+      };
+
+      const FieldRule CODE_RULE = {
+        CODE_WIDTH,
+        {0, 0, 0}, {0xFF, 0xFF, 0xFF},
+        {'a', 'a', 'a'}, {'z', 'z', 'z'},
+        {'0', '0', '0'}, {'9', '9', '9'},
+        false, scalarCode
+      };
+
+      /**
+       * \brief Lane constants of a rule repeated over a whole block.
+       */
+      struct TiledRule
+      {
+        unsigned char low[32 * MAX_WIDTH];
+        unsigned char high[32 * MAX_WIDTH];
+        unsigned char aLow[32 * MAX_WIDTH];
+        unsigned char aHigh[32 * MAX_WIDTH];
+        unsigned char bLow[32 * MAX_WIDTH];
+        unsigned char bHigh[32 * MAX_WIDTH];
+      };
+
+      void tile(const FieldRule& p_rule, size_t p_records, TiledRule& p_tiled)
+      {
+        for (size_t i = 0; i < p_records * p_rule.width; ++i)
+          {
+            size_t lane = i % p_rule.width;
+            p_tiled.low[i] = p_rule.low[lane];
+            p_tiled.high[i] = p_rule.high[lane];
+            p_tiled.aLow[i] = p_rule.aLow[lane];
+            p_tiled.aHigh[i] = p_rule.aHigh[lane];
+            p_tiled.bLow[i] = p_rule.bLow[lane];
+            p_tiled.bHigh[i] = p_rule.bHigh[lane];
+          }
+      }
+
+      // Bit streams of one block: one bit per byte, 32 * MAX_WIDTH bits plus a spare word.
+      const size_t STREAM_WORDS = 32 * MAX_WIDTH / 64 + 1;
+
+      /**
+       * \brief Folds the per-byte streams of a block into one validity bit per record.
+       *
+       * \param[in] p_err Bytes outside their lane range.
+       * \param[in] p_a Bytes inside range A.
+       * \param[in] p_b Bytes inside range B.
+       * \return Bit i is set if record i of the block is valid.
+       */
+      uint32_t reduceBlock(const FieldRule& p_rule, const uint64_t* p_err, const uint64_t* p_a,
+                           const uint64_t* p_b, size_t p_records)
+      {
+        uint64_t bad[STREAM_WORDS] = {};
+        bool anyBad = false;
+        for (size_t w = 0; w + 1 < STREAM_WORDS; ++w)
+          {
+            uint64_t extra = p_rule.pairRule
+                    ? p_a[w] & ((p_b[w] >> 1) | (p_b[w + 1] << 63))
+                    : p_a[w] | p_b[w];
+            bad[w] = p_err[w] | extra;
+            anyBad |= bad[w] != 0;
+          }
+        if (!anyBad)
+          return p_records == 32 ? 0xFFFFFFFFu : (1u << p_records) - 1;
+
+        uint32_t valid = 0;
+        uint64_t fieldMask = (uint64_t(1) << p_rule.width) - 1;
+        for (size_t i = 0; i < p_records; ++i)
+          {
+            size_t bit = i * p_rule.width;
+            uint64_t window = bad[bit / 64] >> (bit % 64);
+            if (bit % 64 != 0)
+              window |= bad[bit / 64 + 1] << (64 - bit % 64);
+            valid |= uint32_t((window & fieldMask) == 0) << i;
+          }
+        return valid;
+      }
+
+#ifdef BATCH_VALIDATION_X86
+      __attribute__((target("avx2")))
+      inline __m256i inRange256(__m256i p_bytes, const unsigned char* p_low, const unsigned char* p_high)
+      {
+        __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_low));
+        __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_high));
+        return _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_max_epu8(p_bytes, low), p_bytes),
+                                _mm256_cmpeq_epi8(_mm256_min_epu8(p_bytes, high), p_bytes));
+      }
+
+      /**
+       * \brief Validates whole blocks of 32 records with AVX2.
+       * \return The number of records handled; the rest is left to the scalar loop.
+       */
+      __attribute__((target("avx2")))
+      size_t validateAvx2(const FieldRule& p_rule, const char* p_column, size_t p_count, uint64_t* p_mask)
+      {
+        TiledRule tiled;
+        tile(p_rule, 32, tiled);
+        size_t i = 0;
+        for (; i + 32 <= p_count; i += 32)
+          {
+            const char* block = p_column + i * p_rule.width;
+            uint64_t err[STREAM_WORDS] = {};
+            uint64_t a[STREAM_WORDS] = {};
+            uint64_t b[STREAM_WORDS] = {};
+            for (size_t v = 0; v < p_rule.width; ++v)
+              {
+                __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32 * v));
+                size_t offset = 32 * v;
+                uint32_t inside = _mm256_movemask_epi8(inRange256(bytes, tiled.low + offset, tiled.high + offset));
+                uint32_t inA = _mm256_movemask_epi8(inRange256(bytes, tiled.aLow + offset, tiled.aHigh + offset));
+                uint32_t inB = _mm256_movemask_epi8(inRange256(bytes, tiled.bLow + offset, tiled.bHigh + offset));
+                err[offset / 64] |= uint64_t(~inside) << (offset % 64);
+                a[offset / 64] |= uint64_t(inA) << (offset % 64);
+                b[offset / 64] |= uint64_t(inB) << (offset % 64);
+              }
+            p_mask[i / 64] |= uint64_t(reduceBlock(p_rule, err, a, b, 32)) << (i % 64);
+          }
+        return i;
+      }
+
+      __attribute__((target("sse4.2")))
+      inline __m128i inRange128(__m128i p_bytes, const unsigned char* p_low, const unsigned char* p_high)
+      {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_low));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_high));
+        return _mm_and_si128(_mm_cmpeq_epi8(_mm_max_epu8(p_bytes, low), p_bytes),
+                             _mm_cmpeq_epi8(_mm_min_epu8(p_bytes, high), p_bytes));
+      }
+
+      /**
+       * \brief Validates whole blocks of 16 records with SSE4.2.
+       * \return The number of records handled; the rest is left to the scalar loop.
+       */
+      __attribute__((target("sse4.2")))
+      size_t validateSse42(const FieldRule& p_rule, const char* p_column, size_t p_count, uint64_t* p_mask)
+      {
+        TiledRule tiled;
+        tile(p_rule, 16, tiled);
+        size_t i = 0;
+        for (; i + 16 <= p_count; i += 16)
+          {
+            const char* block = p_column + i * p_rule.width;
+            uint64_t err[STREAM_WORDS] = {};
+            uint64_t a[STREAM_WORDS] = {};
+            uint64_t b[STREAM_WORDS] = {};
+            for (size_t v = 0; v < p_rule.width; ++v)
+              {
+                __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * v));
+                size_t offset = 16 * v;
+                uint32_t inside = _mm_movemask_epi8(inRange128(bytes, tiled.low + offset, tiled.high + offset));
+                uint32_t inA = _mm_movemask_epi8(inRange128(bytes, tiled.aLow + offset, tiled.aHigh + offset));
+                uint32_t inB = _mm_movemask_epi8(inRange128(bytes, tiled.bLow + offset, tiled.bHigh + offset));
+                err[offset / 64] |= uint64_t(~inside & 0xFFFF) << (offset % 64);
+                a[offset / 64] |= uint64_t(inA) << (offset % 64);
+                b[offset / 64] |= uint64_t(inB) << (offset % 64);
+              }
+            p_mask[i / 64] |= uint64_t(reduceBlock(p_rule, err, a, b, 16)) << (i % 64);
+          }
+        return i;
+      }
+#endif
+
+      /**
+       * \brief Validates a whole column with the best implementation allowed by p_level.
+       */
+      vector<uint64_t> validateColumn(const FieldRule& p_rule, const char* p_column, size_t p_count,
+                                      SimdLevel p_level)
+      {
+        vector<uint64_t> mask((p_count + 63) / 64, 0);
+        SimdLevel level = min(p_level, detectSimdLevel());
+        size_t done = 0;
+#ifdef BATCH_VALIDATION_X86
+        if (level == SimdLevel::Avx2)
+          done = validateAvx2(p_rule, p_column, p_count, mask.data());
+        else if (level == SimdLevel::Sse42)
+          done = validateSse42(p_rule, p_column, p_count, mask.data());
+#endif
+        for (size_t i = done; i < p_count; ++i)
+          {
+            if (p_rule.scalar(p_column + i * p_rule.width))
+              mask[i / 64] |= uint64_t(1) << (i % 64);
+          }
+        return mask;
+      }
+    }
+
+    /**
+     * \brief Returns the fastest instruction set supported by the running processor.
+     *
+     * The CPU is queried once; later calls return the cached answer.
+     *
+     * \return The best SimdLevel available.
+     */
+    SimdLevel detectSimdLevel()
+    {
+#ifdef BATCH_VALIDATION_X86
+      static const SimdLevel level = []
+        {
+          __builtin_cpu_init();
+          if (__builtin_cpu_supports("avx2"))
+            return SimdLevel::Avx2;
+          if (__builtin_cpu_supports("sse4.2"))
+            return SimdLevel::Sse42;
+          return SimdLevel::Scalar;
+        }();
+      return level;
+#else
+      return SimdLevel::Scalar;
+#endif
+    }
+
+    /**
+     * \brief Validates a column of flight numbers.
+     *
+     * Record i occupies bytes [6i, 6i + 6) of p_column and is accepted exactly when
+     * isValidNumber() would accept it.
+     *
+     * \param[in] p_column The records, stored back to back.
+     * \param[in] p_count The number of records.
+     * \param[in] p_level The highest instruction set to use; it is capped to detectSimdLevel().
+     * \return A bitmask of (p_count + 63) / 64 words, bit i % 64 of word i / 64 set if record i is valid.
+     */
+    vector<uint64_t> validateNumberColumn(const char* p_column, size_t p_count, SimdLevel p_level)
+    {
+      return validateColumn(NUMBER_RULE, p_column, p_count, p_level);
+    }
+
+    /**
+     * \brief Validates a column of "HH:MM" hours, 5 bytes per record.
+     * \see validateNumberColumn
+     */
+    vector<uint64_t> validateHourColumn(const char* p_column, size_t p_count, SimdLevel p_level)
+    {
+      return validateColumn(HOUR_RULE, p_column, p_count, p_level);
+    }
+
+    /**
+     * \brief Validates a column of boarding gates, 3 bytes per record.
+     * \see validateNumberColumn
+     */
+    vector<uint64_t> validateGateColumn(const char* p_column, size_t p_count, SimdLevel p_level)
+    {
+      return validateColumn(GATE_RULE, p_column, p_count, p_level);
+    }
+
+    /**
+     * \brief Validates a column of airport codes, 3 bytes per record.
+     * \see validateNumberColumn
+     */
+    vector<uint64_t> validateCodeColumn(const char* p_column, size_t p_count, SimdLevel p_level)
+    {
+      return validateColumn(CODE_RULE, p_column, p_count, p_level);
+    }
+}
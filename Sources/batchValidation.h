@@ -0,0 +1,46 @@
+/**
+ * \file batchValidation.h
+ * \brief Declarations of the columnar batch validators of the Aerien project
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ */
+
+#ifndef BATCHVALIDATION_H
+#define BATCHVALIDATION_H
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+namespace util {
+
+/**
+ * \enum SimdLevel
+ * \brief Instruction sets the batch validators can run on, from slowest to fastest.
+ */
+enum class SimdLevel
+{
+  Scalar,
+  Sse42,
+  Avx2
+};
+
+SimdLevel detectSimdLevel();
+
+const std::size_t NUMBER_WIDTH = 6;
+const std::size_t HOUR_WIDTH = 5;
+const std::size_t GATE_WIDTH = 3;
+const std::size_t CODE_WIDTH = 3;
+
+std::vector<std::uint64_t> validateNumberColumn(const char* p_column, std::size_t p_count,
+                                                SimdLevel p_level = detectSimdLevel());
+std::vector<std::uint64_t> validateHourColumn(const char* p_column, std::size_t p_count,
+                                              SimdLevel p_level = detectSimdLevel());
+std::vector<std::uint64_t> validateGateColumn(const char* p_column, std::size_t p_count,
+                                              SimdLevel p_level = detectSimdLevel());
+std::vector<std::uint64_t> validateCodeColumn(const char* p_column, std::size_t p_count,
+                                              SimdLevel p_level = detectSimdLevel());
+
+}
+
+
+#endif /* BATCHVALIDATION_H */
+
@@ -0,0 +1,184 @@
+/**
+ * \file   AirportBenchmark.cpp
+ * \brief  Google Benchmark suite for the concurrent use of the Airport class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ *
+ * Built and run by "make benchmark CONF=Release" in Sources.
+ */
+#include <benchmark/benchmark.h>
+#include "Airport.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "StatusFeed.h"
+#include "validationFormat.h"
+#include <string>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+namespace
+{
+  const int FLIGHTS = 200;
+  const string STATUSES[] = {" Atterri ", " Retardé ", "À l'heure"};
+
+  /**
+   * \brief Board shared by all the threads of a benchmark, half departures, half arrivals.
+   */
+  Airport& board()
+  {
+    static Airport airport = []
+    {
+      Airport a("YUL");
+      for (int i = 0; i < FLIGHTS; ++i)
+        {
+          string number = to_string(1000 + i);
+          if (i % 2 == 0)
+            a.addFlight(Depart("AC" + number, "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+          else
+            a.addFlight(Arrival("LH" + number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+        }
+      return a;
+    }();
+    return airport;
+  }
+}
+
+/**
+ * \brief Rendering throughput with only readers.
+ */
+static void BM_RenderReaders(benchmark::State& p_state)
+{
+  Airport& airport = board();
+  for (auto _ : p_state)
+    {
+      benchmark::DoNotOptimize(airport.getAirportFormatted());
+    }
+  p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(BM_RenderReaders)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * \brief Lookup throughput with only readers.
+ */
+static void BM_LookupReaders(benchmark::State& p_state)
+{
+  Airport& airport = board();
+  int i = p_state.thread_index();
+  for (auto _ : p_state)
+    {
+      benchmark::DoNotOptimize(airport.getFlight("LH" + to_string(1001 + 2 * (i++ % (FLIGHTS / 2)))));
+    }
+  p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(BM_LookupReaders)->ThreadRange(1, 8)->UseRealTime();
+
+/**
+ * \brief Thread 0 is a status feed, the other threads render the board.
+ *
+ * The status updates per second show how long the writer waits for the readers.
+ */
+static void BM_StatusFeedWithReaders(benchmark::State& p_state)
+{
+  Airport& airport = board();
+  int i = 0;
+  for (auto _ : p_state)
+    {
+      if (p_state.thread_index() == 0)
+        {
+          airport.setFlightStatus("LH" + to_string(1001 + 2 * (i % (FLIGHTS / 2))), STATUSES[i % 3]);
+          ++i;
+        }
+      else
+        {
+          benchmark::DoNotOptimize(airport.getAirportFormatted());
+        }
+    }
+  p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(BM_StatusFeedWithReaders)->ThreadRange(2, 8)->UseRealTime();
+
+/**
+ * \brief Ingest threads adding and deleting their own flights.
+ *
+ * The flights of different threads mostly fall in different shards.
+ */
+static void BM_IngestWriters(benchmark::State& p_state)
+{
+  static Airport airport("YUL");
+  string prefix(1, 'A' + p_state.thread_index());
+  vector<Arrival> arrivals;
+  for (int i = 0; i < 64; ++i)
+    {
+      arrivals.emplace_back(prefix + "X" + to_string(1000 + i), "LUFTHANSA", "22:05", "MUNICH", " Retardé ");
+    }
+  size_t i = 0;
+  for (auto _ : p_state)
+    {
+      const Arrival& arrival = arrivals[i++ % arrivals.size()];
+      airport.tryAddFlight(arrival);
+      airport.tryDeleteFlight(arrival.getNumber());
+    }
+  p_state.SetItemsProcessed(2 * p_state.iterations());
+}
+BENCHMARK(BM_IngestWriters)->ThreadRange(1, 16)->UseRealTime();
+
+/**
+ * \brief Rendering of a 50 000-flight board by 1 to 8 threads.
+ */
+static void BM_RenderLargeBoard(benchmark::State& p_state)
+{
+  static Airport airport = []
+  {
+    Airport a("YUL");
+    for (int i = 0; i < 50000; ++i)
+      {
+        string number = string(1, 'A' + i % 26) + string(1, 'A' + i / 26 % 26) + to_string(1000 + i / 676);
+        if (i % 2 == 0)
+          a.tryAddFlight(Depart(number, "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+        else
+          a.tryAddFlight(Arrival(number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+      }
+    return a;
+  }();
+  Airport::Snapshot board = airport.getSnapshot();
+  for (auto _ : p_state)
+    {
+      benchmark::DoNotOptimize(Airport::formatBoard(*board, p_state.range(0)));
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * board->m_flights.size());
+}
+BENCHMARK(BM_RenderLargeBoard)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/**
+ * \brief Producer-side cost of posting a status change to a StatusFeed.
+ *
+ * A full queue is counted as a failed post, not retried, so the time measured
+ * is the one of the queue itself.
+ */
+static void BM_StatusFeedPost(benchmark::State& p_state)
+{
+  static StatusFeed* feed = nullptr;
+  if (p_state.thread_index() == 0)
+    {
+      feed = new StatusFeed(board(), 1 << 16);
+    }
+  uint32_t number;
+  util::parseNumber("LH" + to_string(1001 + 2 * p_state.thread_index()), number);
+  int64_t rejected = 0;
+  for (auto _ : p_state)
+    {
+      if (!feed->post(number, ArrivalStatus::Landed))
+        ++rejected;
+    }
+  p_state.counters["rejected"] = benchmark::Counter(rejected, benchmark::Counter::kAvgThreads);
+  p_state.SetItemsProcessed(p_state.iterations());
+  if (p_state.thread_index() == 0)
+    {
+      delete feed;
+    }
+}
+BENCHMARK(BM_StatusFeedPost)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
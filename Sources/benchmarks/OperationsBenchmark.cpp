@@ -0,0 +1,488 @@
+/**
+ * \file   OperationsBenchmark.cpp
+ * \brief  Google Benchmark suite for the single-threaded operations of the library.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ *
+ * The Airport operations are measured on boards of 10 to 1 000 000 flights.
+ * Built and run by "make benchmark CONF=Release" in Sources, which also writes
+ * the results as JSON next to the binary so two runs can be compared with
+ * Google Benchmark's tools/compare.py.
+ */
+#include <benchmark/benchmark.h>
+#include "Airport.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "Executor.h"
+#include "FlightSearchIndex.h"
+#include "ScheduleGenerator.h"
+#include "arenaResource.h"
+#include "metrics.h"
+#include "validationFormat.h"
+#include <cstdio>
+#include <map>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+namespace
+{
+  const int64_t SMALLEST_BOARD = 10;
+  const int64_t LARGEST_BOARD = 1000000;
+
+  /**
+   * \brief Flights measured per refill by the add and delete benchmarks.
+   */
+  const int POOL = 1024;
+
+  /**
+   * \brief Returns the p_index-th distinct flight number ("AA0000", "BA0000", ...).
+   */
+  string numberOf(int64_t p_index)
+  {
+    // Room for any int, although the modulo keeps four digits
+    char number[16];
+    snprintf(number, sizeof(number), "%c%c%04d", 'A' + static_cast<int>(p_index % 26),
+             'A' + static_cast<int>(p_index / 26 % 26), static_cast<int>(p_index / 676 % 10000));
+    return number;
+  }
+
+  /**
+   * \brief Builds the flight of index p_index, departures and arrivals alternating.
+   */
+  unique_ptr<Flight> makeFlight(int64_t p_index)
+  {
+    if (p_index % 2 == 0)
+      return make_unique<Depart>(numberOf(p_index), "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86");
+    return make_unique<Arrival>(numberOf(p_index), "LUFTHANSA", "22:05", "MUNICH", " Retardé ");
+  }
+
+  /**
+   * \brief Board of p_size flights, built once per size and shared by the benchmarks.
+   */
+  Airport& board(int64_t p_size)
+  {
+    static map<int64_t, unique_ptr<Airport>> boards;
+    unique_ptr<Airport>& airport = boards[p_size];
+    if (!airport)
+      {
+        airport = make_unique<Airport>("YUL");
+        vector<unique_ptr<Flight>> flights;
+        vector<const Flight*> pointers;
+        for (int64_t i = 0; i < p_size; ++i)
+          {
+            flights.push_back(makeFlight(i));
+            pointers.push_back(flights.back().get());
+          }
+        airport->tryAddFlights(pointers);
+      }
+    return *airport;
+  }
+
+  /**
+   * \brief Flights numbered after the p_size ones of board(p_size).
+   */
+  vector<unique_ptr<Flight>> pool(int64_t p_size)
+  {
+    vector<unique_ptr<Flight>> flights;
+    for (int64_t i = 0; i < POOL; ++i)
+      {
+        flights.push_back(makeFlight(p_size + i));
+      }
+    return flights;
+  }
+
+  /**
+   * \brief Board sizes 10, 100, ... 1 000 000.
+   */
+  void boardSizes(benchmark::internal::Benchmark* p_benchmark)
+  {
+    p_benchmark->RangeMultiplier(10)->Range(SMALLEST_BOARD, LARGEST_BOARD);
+  }
+}
+
+/**
+ * \brief Airport::addFlight on a board of range(0) flights, with the publication of the new board.
+ *
+ * Each iteration takes a snapshot after the mutation, which waits for the
+ * board holding it, so the measure includes the publication rather than
+ * leaving it to the Executor. The added flights are deleted, outside the
+ * measure, every POOL iterations.
+ */
+static void BM_AddFlight(benchmark::State& p_state)
+{
+  Airport& airport = board(p_state.range(0));
+  vector<unique_ptr<Flight>> flights = pool(p_state.range(0));
+  size_t next = 0;
+  for (auto _ : p_state)
+    {
+      if (next == flights.size())
+        {
+          p_state.PauseTiming();
+          for (const auto& flight : flights)
+            airport.deleteFlight(flight->getNumber());
+          airport.getSnapshot();
+          next = 0;
+          p_state.ResumeTiming();
+        }
+      airport.addFlight(*flights[next++]);
+      benchmark::DoNotOptimize(airport.getSnapshot()->m_version);
+    }
+  for (size_t i = 0; i < next; ++i)
+    airport.deleteFlight(flights[i]->getNumber());
+  p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(BM_AddFlight)->Apply(boardSizes);
+
+/**
+ * \brief Airport::deleteFlight on a board of range(0) flights, with the publication of the new board.
+ *
+ * As for BM_AddFlight, a snapshot taken after each mutation brings the
+ * publication into the measure. The deleted flights are added back, outside
+ * the measure, every POOL iterations.
+ */
+static void BM_DeleteFlight(benchmark::State& p_state)
+{
+  Airport& airport = board(p_state.range(0));
+  vector<unique_ptr<Flight>> flights = pool(p_state.range(0));
+  vector<string> numbers;
+  for (const auto& flight : flights)
+    numbers.emplace_back(flight->getNumber());
+  size_t next = numbers.size();
+  for (auto _ : p_state)
+    {
+      if (next == numbers.size())
+        {
+          p_state.PauseTiming();
+          for (const auto& flight : flights)
+            airport.addFlight(*flight);
+          airport.getSnapshot();
+          next = 0;
+          p_state.ResumeTiming();
+        }
+      airport.deleteFlight(numbers[next++]);
+      benchmark::DoNotOptimize(airport.getSnapshot()->m_version);
+    }
+  for (size_t i = next; i < numbers.size(); ++i)
+    airport.deleteFlight(numbers[i]);
+  p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(BM_DeleteFlight)->Apply(boardSizes);
+
+/**
+ * \brief Airport::getAirportFormatted on a board of range(0) flights.
+ */
+static void BM_AirportFormatted(benchmark::State& p_state)
+{
+  Airport& airport = board(p_state.range(0));
+  for (auto _ : p_state)
+    {
+      benchmark::DoNotOptimize(airport.getAirportFormatted());
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * p_state.range(0));
+}
+BENCHMARK(BM_AirportFormatted)->Apply(boardSizes)->Unit(benchmark::kMicrosecond);
+
+/**
+ * \brief Copy construction of a board of range(0) flights.
+ */
+static void BM_AirportCopy(benchmark::State& p_state)
+{
+  Airport& airport = board(p_state.range(0));
+  for (auto _ : p_state)
+    {
+      Airport copy(airport);
+      benchmark::DoNotOptimize(copy);
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * p_state.range(0));
+}
+BENCHMARK(BM_AirportCopy)->Apply(boardSizes)->Unit(benchmark::kMicrosecond);
+
+/**
+ * \brief Assignment of a board of range(0) flights over an already filled board.
+ */
+static void BM_AirportAssignment(benchmark::State& p_state)
+{
+  Airport& airport = board(p_state.range(0));
+  Airport target(airport);
+  for (auto _ : p_state)
+    {
+      target = airport;
+      benchmark::ClobberMemory();
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * p_state.range(0));
+}
+BENCHMARK(BM_AirportAssignment)->Apply(boardSizes)->Unit(benchmark::kMicrosecond);
+
+namespace
+{
+  /**
+   * \brief Runs a validator over valid and invalid fields, one field per iteration.
+   */
+  template <typename Validator>
+  void validate(benchmark::State& p_state, Validator p_validator, const vector<string>& p_fields)
+  {
+    size_t i = 0;
+    for (auto _ : p_state)
+      {
+        benchmark::DoNotOptimize(p_validator(p_fields[i++ % p_fields.size()]));
+      }
+    p_state.SetItemsProcessed(p_state.iterations());
+  }
+}
+
+static void BM_IsValidNumber(benchmark::State& p_state)
+{
+  validate(p_state, util::isValidNumber, {"AC1636", "DL5064", "A21634", "AC163", "ac1636"});
+}
+BENCHMARK(BM_IsValidNumber);
+
+/**
+ * \brief isValidNumber with the metrics enabled: the cost of recording a call.
+ */
+static void BM_IsValidNumberRecorded(benchmark::State& p_state)
+{
+  util::setMetricsEnabled(true);
+  validate(p_state, util::isValidNumber, {"AC1636", "DL5064", "A21634", "AC163", "ac1636"});
+  util::setMetricsEnabled(false);
+}
+BENCHMARK(BM_IsValidNumberRecorded);
+
+static void BM_IsValid24Format(benchmark::State& p_state)
+{
+  validate(p_state, util::isValid24Format, {"23:59", "00:00", "24:00", "12:60", "1:00"});
+}
+BENCHMARK(BM_IsValid24Format);
+
+static void BM_IsValidGate(benchmark::State& p_state)
+{
+  validate(p_state, util::isValidGate, {"C86", "A01", "C00", "c86", "C8"});
+}
+BENCHMARK(BM_IsValidGate);
+
+static void BM_IsValidName(benchmark::State& p_state)
+{
+  validate(p_state, util::isValidName, {"AIR CANADA", "ORLONDO", "AIR  CANADA", "Lufthansa", "SAINT-JEAN-SUR-RICHE"});
+}
+BENCHMARK(BM_IsValidName);
+
+static void BM_IsValideCode(benchmark::State& p_state)
+{
+  validate(p_state, util::isValideCode, {"YUL", "A-B", "Yu1", "YULL"});
+}
+BENCHMARK(BM_IsValideCode);
+
+static void BM_IsValidStatus(benchmark::State& p_state)
+{
+  validate(p_state, util::isValidStatus, {" Atterri ", " Retardé ", "À l'heure", "Atterri"});
+}
+BENCHMARK(BM_IsValidStatus);
+
+/**
+ * \brief util::adjustWidth on fields shorter than, equal to and longer than the width.
+ */
+static void BM_AdjustWidth(benchmark::State& p_state)
+{
+  const vector<string> fields = {"YUL", "AIR CANADA", "SAINT-JEAN-SUR-RICH", "SAINT-JEAN-SUR-RICHELIEU"};
+  size_t i = 0;
+  for (auto _ : p_state)
+    {
+      benchmark::DoNotOptimize(util::adjustWidth(fields[i++ % fields.size()]));
+    }
+  p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(BM_AdjustWidth);
+
+/**
+ * \brief ScheduleGenerator::generate, flights per second.
+ */
+static void BM_GenerateSchedule(benchmark::State& p_state)
+{
+  ScheduleGenerator generator(1);
+  vector<ScheduledFlight> flights(4096);
+  for (auto _ : p_state)
+    {
+      if (generator.getGeneratedCount() + flights.size() > ScheduleGenerator::MAX_FLIGHTS)
+        generator = ScheduleGenerator(1);
+      generator.generate(flights.data(), flights.size());
+      benchmark::DoNotOptimize(flights.data());
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * flights.size());
+}
+BENCHMARK(BM_GenerateSchedule);
+
+/**
+ * \brief Schedule output as CSV (range(0) == 0) or binary (range(0) == 1), 100 000 flights.
+ */
+static void BM_WriteSchedule(benchmark::State& p_state)
+{
+  const size_t count = 100000;
+  for (auto _ : p_state)
+    {
+      ostringstream os;
+      ScheduleGenerator generator(1);
+      if (p_state.range(0) == 0)
+        generator.writeCsv(os, count);
+      else
+        generator.writeBinary(os, count);
+      benchmark::DoNotOptimize(os);
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * count);
+}
+BENCHMARK(BM_WriteSchedule)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+/**
+ * \brief ScheduleGenerator::fill of an empty airport with range(0) flights.
+ */
+static void BM_FillAirport(benchmark::State& p_state)
+{
+  for (auto _ : p_state)
+    {
+      Airport airport("YUL");
+      benchmark::DoNotOptimize(ScheduleGenerator(1).fill(airport, p_state.range(0)));
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * p_state.range(0));
+}
+BENCHMARK(BM_FillAirport)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+/**
+ * \brief FlightSearchIndex over 100 000 generated flights: range(0) == 0 builds
+ *        the index, range(0) == 1 runs the queries an operator types letter by letter.
+ */
+static void BM_SearchIndex(benchmark::State& p_state)
+{
+  const size_t count = 100000;
+  const char* const queries[] = {"A", "AC", "AC1", "AC12", "P", "PA", "PAR", "B2"};
+  Airport airport("YUL");
+  ScheduleGenerator(1).fill(airport, count);
+  Airport::Snapshot board = airport.getSnapshot();
+  FlightSearchIndex index(board->m_flights);
+  vector<bool> matches;
+  for (auto _ : p_state)
+    {
+      if (p_state.range(0) == 0)
+        {
+          FlightSearchIndex built(board->m_flights);
+          benchmark::DoNotOptimize(built);
+        }
+      else
+        {
+          for (const char* query : queries)
+            benchmark::DoNotOptimize(index.search(query, matches));
+        }
+    }
+  p_state.SetItemsProcessed(p_state.iterations() * (p_state.range(0) == 0 ? count : size(queries)));
+}
+BENCHMARK(BM_SearchIndex)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+namespace
+{
+  /**
+   * \brief Bytes the allocator holds for the program, or 0 when unknown.
+   */
+  size_t heapInUse()
+  {
+#ifdef __GLIBC__
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+  }
+
+  const char* const LAYOUTS[] = {"Airport", "vector<unique_ptr<Flight>>", "ScheduledFlight records"};
+}
+
+/**
+ * \brief Memory of 100 000 generated flights for each storage layout.
+ *
+ * range(0) selects the layout: 0 the Airport shards and board, 1 the
+ * vector<unique_ptr<Flight>> the Airport used to hold, 2 the packed records
+ * of the schedule generator. "accounted" is the MemoryUsage breakdown (the
+ * Airport's own for layout 0), "measured" the growth of the allocator's heap.
+ */
+static void BM_MemoryPerFlight(benchmark::State& p_state)
+{
+  const size_t count = 100000;
+  Executor::instance();
+  double accounted = 0, measured = 0;
+  for (auto _ : p_state)
+    {
+      size_t before = heapInUse();
+      MemoryUsage usage;
+      if (p_state.range(0) == 0)
+        {
+          Airport airport("YUL");
+          ScheduleGenerator(1).fill(airport, count);
+          usage = airport.memoryUsage();
+          measured = static_cast<double>(heapInUse() - before);
+        }
+      else if (p_state.range(0) == 1)
+        {
+          ScheduleGenerator generator(1);
+          vector<unique_ptr<Flight>> flights;
+          for (size_t i = 0; i < count; ++i)
+            flights.push_back(ScheduleGenerator::makeFlight(generator.next()));
+          for (const auto& flight : flights)
+            flight->addMemoryUsage(usage);
+          usage.m_index += flights.capacity() * sizeof(unique_ptr<Flight>);
+          usage.addAllocation(flights.capacity() * sizeof(unique_ptr<Flight>));
+          measured = static_cast<double>(heapInUse() - before);
+        }
+      else
+        {
+          vector<ScheduledFlight> flights(count);
+          ScheduleGenerator(1).generate(flights.data(), count);
+          usage.m_objects += count * sizeof(ScheduledFlight);
+          usage.addAllocation(count * sizeof(ScheduledFlight));
+          measured = static_cast<double>(heapInUse() - before);
+        }
+      accounted = static_cast<double>(usage.total());
+    }
+  p_state.SetLabel(LAYOUTS[p_state.range(0)]);
+  p_state.counters["accounted_bytes_per_flight"] = accounted / count;
+  p_state.counters["measured_bytes_per_flight"] = measured / count;
+  p_state.SetItemsProcessed(p_state.iterations() * count);
+}
+BENCHMARK(BM_MemoryPerFlight)->DenseRange(0, 2)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+/**
+ * \brief Lifetime of a day-scoped airport of 100 000 flights: filled, then destroyed.
+ *
+ * range(0) selects the memory resource of the flights and of the indexes:
+ * 0 the heap, 1 a util::ArenaResource released with the airport.
+ */
+static void BM_AirportLifetime(benchmark::State& p_state)
+{
+  const size_t count = 100000;
+  ScheduleGenerator generator(1);
+  vector<unique_ptr<Flight>> flights;
+  vector<const Flight*> pointers;
+  for (size_t i = 0; i < count; ++i)
+    {
+      flights.push_back(ScheduleGenerator::makeFlight(generator.next()));
+      pointers.push_back(flights.back().get());
+    }
+  Executor::instance();
+  util::ArenaResource arena(1 << 20);
+  pmr::memory_resource* resource = p_state.range(0) == 0 ? pmr::new_delete_resource() : &arena;
+  for (auto _ : p_state)
+    {
+      {
+        Airport airport("YUL", resource);
+        benchmark::DoNotOptimize(airport.tryAddFlights(pointers));
+      }
+      arena.release();
+    }
+  p_state.SetLabel(p_state.range(0) == 0 ? "heap" : "arena");
+  p_state.SetItemsProcessed(p_state.iterations() * count);
+}
+BENCHMARK(BM_AirportLifetime)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,64 @@
+/**
+ * \file characterClass.h
+ * \brief Compile-time character classification table used by the validators
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * The table reproduces the "C" locale answers of isupper, islower and isdigit
+ * without calling into the C library, so it can be used in constant expressions
+ * and costs a single indexed load at run time.
+ */
+
+#ifndef CHARACTERCLASS_H
+#define CHARACTERCLASS_H
+#include <array>
+namespace util {
+
+const unsigned char CLASS_UPPER = 0x01;
+const unsigned char CLASS_LOWER = 0x02;
+const unsigned char CLASS_DIGIT = 0x04;
+const unsigned char CLASS_SEPARATOR = 0x08;
+
+/**
+ * \brief Builds the 256-entry class table.
+ * \return Entry c holds the CLASS_* bits of the byte c.
+ */
+constexpr std::array<unsigned char, 256> makeCharacterClasses()
+{
+  std::array<unsigned char, 256> classes {};
+  for (int c = 'A'; c <= 'Z'; ++c)
+    classes[c] = CLASS_UPPER;
+  for (int c = 'a'; c <= 'z'; ++c)
+    classes[c] = CLASS_LOWER;
+  for (int c = '0'; c <= '9'; ++c)
+    classes[c] = CLASS_DIGIT;
+  classes['-'] = CLASS_SEPARATOR;
+  classes[' '] = CLASS_SEPARATOR;
+  return classes;
+}
+
+inline constexpr std::array<unsigned char, 256> CHARACTER_CLASSES = makeCharacterClasses();
+
+/**
+ * \brief Returns the CLASS_* bits of a character.
+ */
+constexpr unsigned char characterClass(char p_character)
+{
+  return CHARACTER_CLASSES[static_cast<unsigned char>(p_character)];
+}
+
+constexpr bool isUpper(char p_character)
+{
+  return characterClass(p_character) & CLASS_UPPER;
+}
+
+constexpr bool isDigit(char p_character)
+{
+  return characterClass(p_character) & CLASS_DIGIT;
+}
+
+}
+
+
+#endif /* CHARACTERCLASS_H */
+
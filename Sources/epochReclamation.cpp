@@ -0,0 +1,239 @@
+/**
+ * \file epochReclamation.cpp
+ * \brief Implementation of the epoch-based reclamation
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * The global epoch only moves from e to e + 1 when every active reader has
+ * entered e. An object retired while the global epoch was r can then only be
+ * seen by readers of r - 1 or r, and is deleted once the epoch reaches r + 2.
+ * All the epoch accesses are sequentially consistent, which orders the unlink
+ * of an object before the epoch a later reader enters.
+ */
+
+#include "epochReclamation.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace util {
+
+namespace {
+
+const std::size_t SLOTS_PER_BLOCK = 64;
+const std::size_t RECLAIM_THRESHOLD = 64;
+
+/**
+ * \brief Epoch announced by one reader thread, 0 when it is outside any guard.
+ */
+struct alignas(64) ThreadSlot
+{
+  std::atomic<std::uint64_t> m_epoch {0};
+  std::atomic<bool> m_used {false};
+};
+
+/**
+ * \brief Slots of the reader threads; a block is chained when all the previous ones are taken.
+ *
+ * The blocks are never freed before the domain, so a scan needs no lock.
+ */
+struct SlotBlock
+{
+  ThreadSlot m_slots[SLOTS_PER_BLOCK];
+  std::atomic<SlotBlock*> m_next {nullptr};
+};
+
+struct Retired
+{
+  void* m_object;
+  void (*m_deleter)(void*);
+  std::uint64_t m_epoch;
+};
+
+/**
+ * \brief State shared by all the threads; the objects still retired at exit are deleted.
+ */
+struct Domain
+{
+  std::atomic<std::uint64_t> m_globalEpoch {1};
+  SlotBlock m_slots;
+  std::mutex m_retiredMutex;
+  std::vector<Retired> m_retired;
+
+  ~Domain()
+  {
+    for (const Retired& retired : m_retired)
+      retired.m_deleter(retired.m_object);
+    for (SlotBlock* block = m_slots.m_next.load(); block != nullptr; )
+      {
+        SlotBlock* next = block->m_next.load();
+        delete block;
+        block = next;
+      }
+  }
+};
+
+Domain& domain()
+{
+  static Domain s_domain;
+  return s_domain;
+}
+
+/**
+ * \brief Slot of the calling thread, claimed on first use and freed at thread exit.
+ */
+struct ThreadRecord
+{
+  ThreadSlot* m_slot = nullptr;
+  unsigned int m_depth = 0;
+
+  ~ThreadRecord()
+  {
+    if (m_slot != nullptr)
+      {
+        m_slot->m_epoch.store(0);
+        m_slot->m_used.store(false, std::memory_order_release);
+      }
+  }
+};
+
+ThreadRecord& threadRecord()
+{
+  thread_local ThreadRecord s_record;
+  if (s_record.m_slot == nullptr)
+    {
+      SlotBlock* block = &domain().m_slots;
+      while (s_record.m_slot == nullptr)
+        {
+          for (ThreadSlot& slot : block->m_slots)
+            {
+              bool unused = false;
+              if (slot.m_used.compare_exchange_strong(unused, true, std::memory_order_acquire))
+                {
+                  s_record.m_slot = &slot;
+                  break;
+                }
+            }
+          if (s_record.m_slot != nullptr)
+            break;
+          SlotBlock* next = block->m_next.load();
+          if (next == nullptr)
+            {
+              // Every slot is taken: a new block is chained, unless another thread chained one first
+              SlotBlock* added = new SlotBlock;
+              if (block->m_next.compare_exchange_strong(next, added))
+                next = added;
+              else
+                delete added;
+            }
+          block = next;
+        }
+    }
+  return s_record;
+}
+
+/**
+ * \brief Moves the global epoch forward if every active reader is in it.
+ * \pre The caller holds m_retiredMutex.
+ */
+void tryAdvance(Domain& p_domain)
+{
+  std::uint64_t epoch = p_domain.m_globalEpoch.load();
+  for (const SlotBlock* block = &p_domain.m_slots; block != nullptr; block = block->m_next.load())
+    {
+      for (const ThreadSlot& slot : block->m_slots)
+        {
+          if (!slot.m_used.load(std::memory_order_acquire))
+            continue;
+          std::uint64_t local = slot.m_epoch.load();
+          if (local != 0 && local != epoch)
+            return;
+        }
+    }
+  p_domain.m_globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+}
+
+/**
+ * \brief Deletes the objects no reader can reach anymore.
+ * \pre The caller holds m_retiredMutex.
+ * \return The number of objects deleted.
+ */
+std::size_t freeExpired(Domain& p_domain)
+{
+  tryAdvance(p_domain);
+  std::uint64_t epoch = p_domain.m_globalEpoch.load();
+  // The objects are retired in epoch order, the expired ones form a prefix
+  std::size_t count = 0;
+  while (count < p_domain.m_retired.size() && p_domain.m_retired[count].m_epoch + 2 <= epoch)
+    {
+      p_domain.m_retired[count].m_deleter(p_domain.m_retired[count].m_object);
+      ++count;
+    }
+  p_domain.m_retired.erase(p_domain.m_retired.begin(), p_domain.m_retired.begin() + count);
+  return count;
+}
+
+}
+
+/**
+ * \brief Enters the epoch critical section of the calling thread.
+ */
+EpochGuard::EpochGuard()
+{
+  ThreadRecord& record = threadRecord();
+  if (record.m_depth++ == 0)
+    record.m_slot->m_epoch.store(domain().m_globalEpoch.load());
+}
+
+/**
+ * \brief Leaves the critical section; the objects read inside may then be deleted.
+ */
+EpochGuard::~EpochGuard()
+{
+  ThreadRecord& record = threadRecord();
+  if (--record.m_depth == 0)
+    record.m_slot->m_epoch.store(0);
+}
+
+/**
+ * \brief Schedules the deletion of an unlinked object.
+ *
+ * The deletions are attempted by batches, once RECLAIM_THRESHOLD objects wait.
+ *
+ * \param[in] p_object The object, no longer reachable by new readers.
+ * \param[in] p_deleter The function deleting the object.
+ */
+void retire(void* p_object, void (*p_deleter)(void*))
+{
+  Domain& d = domain();
+  std::lock_guard<std::mutex> lock(d.m_retiredMutex);
+  d.m_retired.push_back({p_object, p_deleter, d.m_globalEpoch.load()});
+  if (d.m_retired.size() >= RECLAIM_THRESHOLD)
+    freeExpired(d);
+}
+
+/**
+ * \brief Deletes the retired objects that no reader can reach anymore.
+ * \return The number of objects deleted.
+ */
+std::size_t reclaim()
+{
+  Domain& d = domain();
+  std::lock_guard<std::mutex> lock(d.m_retiredMutex);
+  std::size_t count = freeExpired(d);
+  // A second pass lets an idle domain move two epochs and empty itself
+  return count + freeExpired(d);
+}
+
+/**
+ * \brief Returns the number of retired objects not deleted yet.
+ */
+std::size_t retiredCount()
+{
+  Domain& d = domain();
+  std::lock_guard<std::mutex> lock(d.m_retiredMutex);
+  return d.m_retired.size();
+}
+
+}
@@ -0,0 +1,48 @@
+/**
+ * \file epochReclamation.h
+ * \brief Epoch-based reclamation of objects read without locks
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * A reader opens an EpochGuard before loading a shared pointer and keeps it
+ * while it uses the object. A writer that unlinks an object hands it to
+ * retire(); the object is deleted once every guard that might have seen it
+ * is closed. Readers never wait: they only publish the epoch they entered.
+ */
+
+#ifndef EPOCHRECLAMATION_H
+#define EPOCHRECLAMATION_H
+#include <cstddef>
+namespace util {
+
+/**
+ * \class EpochGuard
+ * \brief Critical section of a reader. Guards can be nested on the same thread.
+ */
+class EpochGuard
+{
+public:
+  EpochGuard();
+  ~EpochGuard();
+  EpochGuard(const EpochGuard&) = delete;
+  EpochGuard& operator=(const EpochGuard&) = delete;
+};
+
+void retire(void* p_object, void (*p_deleter)(void*));
+std::size_t reclaim();
+std::size_t retiredCount();
+
+/**
+ * \brief Hands an unlinked object over to the reclamation.
+ * \param[in] p_object An object allocated with new, no longer reachable by new readers.
+ */
+template <typename T>
+void retireObject(const T* p_object)
+{
+  retire(const_cast<T*>(p_object), [](void* p_retired) { delete static_cast<T*>(p_retired); });
+}
+
+}
+
+
+#endif /* EPOCHRECLAMATION_H */
@@ -0,0 +1,136 @@
+/**
+ * \file fieldLiterals.h
+ * \brief Compile-time validated flight field literals ("AC1636"_fn, "C86"_gate, ...)
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * A ValidatedField can only be built in a constant expression, from a string
+ * accepted by the matching validator; a bad literal stops the compilation.
+ * Constructors taking these types can therefore skip their run-time checks.
+ */
+
+#ifndef FIELDLITERALS_H
+#define FIELDLITERALS_H
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include "validationFormat.h"
+namespace util {
+
+/**
+ * \class ValidatedField
+ * \brief A field value proven valid at compile time.
+ *
+ * \tparam Rule A type providing a constexpr static bool isValid(std::string_view)
+ *         and a static constexpr const char* s_description.
+ */
+template <typename Rule>
+class ValidatedField
+{
+public:
+  /**
+   * \brief Validates a literal during compilation.
+   * \param[in] p_value The field text; it must have static storage duration.
+   */
+  consteval explicit ValidatedField(std::string_view p_value): m_value(p_value)
+  {
+    if (!Rule::isValid(p_value))
+      throw std::invalid_argument(Rule::s_description);
+  }
+
+  constexpr std::string_view value() const
+  {
+    return m_value;
+  }
+
+  std::string str() const
+  {
+    return std::string(m_value);
+  }
+
+private:
+  std::string_view m_value;
+};
+
+struct NumberRule
+{
+  static constexpr const char* s_description = "invalid flight number literal";
+  static constexpr bool isValid(std::string_view p_value) { return isValidNumber(p_value); }
+};
+
+struct NameRule
+{
+  static constexpr const char* s_description = "invalid company or city literal";
+  static constexpr bool isValid(std::string_view p_value) { return isValidName(p_value); }
+};
+
+struct HourRule
+{
+  static constexpr const char* s_description = "invalid 24-hour literal";
+  static constexpr bool isValid(std::string_view p_value) { return isValid24Format(p_value); }
+};
+
+struct GateRule
+{
+  static constexpr const char* s_description = "invalid gate literal";
+  static constexpr bool isValid(std::string_view p_value) { return isValidGate(p_value); }
+};
+
+struct CodeRule
+{
+  static constexpr const char* s_description = "invalid airport code literal";
+  static constexpr bool isValid(std::string_view p_value) { return isValideCode(p_value); }
+};
+
+struct StatusRule
+{
+  static constexpr const char* s_description = "invalid arrival status literal";
+  static constexpr bool isValid(std::string_view p_value) { return isValidStatus(p_value); }
+};
+
+typedef ValidatedField<NumberRule> FlightNumber;
+typedef ValidatedField<NameRule> Name;
+typedef ValidatedField<HourRule> Hour;
+typedef ValidatedField<GateRule> Gate;
+typedef ValidatedField<CodeRule> Code;
+typedef ValidatedField<StatusRule> Status;
+
+inline namespace literals {
+
+consteval FlightNumber operator""_fn(const char* p_text, std::size_t p_length)
+{
+  return FlightNumber(std::string_view(p_text, p_length));
+}
+
+consteval Name operator""_name(const char* p_text, std::size_t p_length)
+{
+  return Name(std::string_view(p_text, p_length));
+}
+
+consteval Hour operator""_hour(const char* p_text, std::size_t p_length)
+{
+  return Hour(std::string_view(p_text, p_length));
+}
+
+consteval Gate operator""_gate(const char* p_text, std::size_t p_length)
+{
+  return Gate(std::string_view(p_text, p_length));
+}
+
+consteval Code operator""_code(const char* p_text, std::size_t p_length)
+{
+  return Code(std::string_view(p_text, p_length));
+}
+
+consteval Status operator""_status(const char* p_text, std::size_t p_length)
+{
+  return Status(std::string_view(p_text, p_length));
+}
+
+}
+}
+
+
+#endif /* FIELDLITERALS_H */
+
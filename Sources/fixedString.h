@@ -0,0 +1,106 @@
+/**
+ * \file fixedString.h
+ * \brief String of bounded length stored inline, for the fixed-size flight fields
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ */
+
+#ifndef FIXEDSTRING_H
+#define FIXEDSTRING_H
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace util {
+
+/**
+ * \class FixedString
+ * \brief String of at most N characters, held in the object itself.
+ *
+ * The characters are followed by a terminating null; a FixedString never
+ * allocates and is itself trivially copyable. A class whose fields are
+ * FixedStrings is copied without allocating, but it is only trivially
+ * copyable if it has no virtual members: Flight and its subclasses are
+ * polymorphic, so their copies still go through their copy constructors.
+ *
+ * \tparam N The capacity, in bytes; at most 255.
+ */
+template <std::size_t N>
+class FixedString
+{
+  static_assert(N <= UINT8_MAX, "the length of a FixedString is stored in a byte");
+
+public:
+  constexpr FixedString() noexcept: m_size(0), m_data{}
+  {
+  }
+
+  /**
+   * \brief Copies a text in the string.
+   * \param[in] p_text The text, of at most N bytes.
+   * \throws std::length_error if p_text is longer than N bytes, as std::string does past max_size().
+   */
+  constexpr explicit FixedString(std::string_view p_text): m_size(0), m_data{}
+  {
+    if (p_text.size() > N)
+      throw std::length_error("text longer than the capacity of the FixedString");
+    m_size = static_cast<std::uint8_t>(p_text.size());
+    for (std::size_t i = 0; i < p_text.size(); ++i)
+      m_data[i] = p_text[i];
+  }
+
+  static constexpr std::size_t capacity() noexcept
+  {
+    return N;
+  }
+
+  constexpr std::size_t size() const noexcept
+  {
+    return m_size;
+  }
+
+  constexpr bool empty() const noexcept
+  {
+    return m_size == 0;
+  }
+
+  constexpr const char* c_str() const noexcept
+  {
+    return m_data;
+  }
+
+  constexpr std::string_view view() const noexcept
+  {
+    return std::string_view(m_data, m_size);
+  }
+
+  constexpr operator std::string_view() const noexcept
+  {
+    return view();
+  }
+
+  std::string str() const
+  {
+    return std::string(m_data, m_size);
+  }
+
+  friend constexpr bool operator==(const FixedString& p_a, const FixedString& p_b) noexcept
+  {
+    return p_a.view() == p_b.view();
+  }
+
+  friend constexpr bool operator==(const FixedString& p_a, std::string_view p_b) noexcept
+  {
+    return p_a.view() == p_b;
+  }
+
+private:
+  std::uint8_t m_size;
+  char m_data[N + 1];
+};
+
+}
+
+#endif /* FIXEDSTRING_H */
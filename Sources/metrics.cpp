@@ -0,0 +1,251 @@
+/**
+ * \file metrics.cpp
+ * \brief Implementation of the per-operation counters and latency histograms
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * Every thread that records an operation takes a ThreadCounters block from a
+ * lock-free list and gives it back when it exits; a later thread reuses the
+ * block and keeps adding to its counters, so the sums stay exact. Only the
+ * owner writes a block, with relaxed loads and stores; readers sum the
+ * blocks with relaxed loads and may see a call half recorded.
+ */
+
+#include "metrics.h"
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+#include <mutex>
+
+namespace util {
+
+namespace {
+
+struct Counters
+{
+  std::atomic<std::uint64_t> m_calls {0};
+  std::atomic<std::uint64_t> m_failures {0};
+  std::atomic<std::uint64_t> m_nanoseconds {0};
+  std::atomic<std::uint64_t> m_buckets[LATENCY_BUCKETS] {};
+};
+
+struct alignas(64) ThreadCounters
+{
+  Counters m_operations[OPERATION_COUNT];
+  std::atomic<bool> m_owned {true};
+  ThreadCounters* m_next = nullptr;
+};
+
+std::atomic<ThreadCounters*> s_blocks {nullptr};
+
+/**
+ * \brief Counters already reported when resetMetrics() was last called.
+ */
+std::mutex s_baselineMutex;
+OperationStats s_baseline[OPERATION_COUNT] {};
+
+/**
+ * \brief Takes a free block, or pushes a new one; blocks are never freed.
+ */
+ThreadCounters* acquireBlock()
+{
+  for (ThreadCounters* block = s_blocks.load(std::memory_order_acquire); block; block = block->m_next)
+    {
+      bool owned = false;
+      if (!block->m_owned.load(std::memory_order_relaxed)
+          && block->m_owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+        return block;
+    }
+  ThreadCounters* block = new ThreadCounters;
+  block->m_next = s_blocks.load(std::memory_order_relaxed);
+  while (!s_blocks.compare_exchange_weak(block->m_next, block, std::memory_order_release))
+    {
+    }
+  return block;
+}
+
+/**
+ * \brief Block of the calling thread, given back when the thread exits.
+ */
+struct BlockOwner
+{
+  ThreadCounters* m_block = acquireBlock();
+
+  ~BlockOwner()
+  {
+    m_block->m_owned.store(false, std::memory_order_release);
+  }
+};
+
+Counters& countersOf(Operation p_operation)
+{
+  thread_local BlockOwner owner;
+  return owner.m_block->m_operations[static_cast<std::size_t>(p_operation)];
+}
+
+void increment(std::atomic<std::uint64_t>& p_counter, std::uint64_t p_amount)
+{
+  p_counter.store(p_counter.load(std::memory_order_relaxed) + p_amount, std::memory_order_relaxed);
+}
+
+std::size_t bucketOf(std::uint64_t p_nanoseconds)
+{
+  std::size_t bucket = 64 - std::countl_zero(p_nanoseconds);
+  return bucket < LATENCY_BUCKETS ? bucket : LATENCY_BUCKETS - 1;
+}
+
+/**
+ * \brief Sums the counters of every block, without the baseline.
+ */
+OperationStats sum(Operation p_operation)
+{
+  std::size_t index = static_cast<std::size_t>(p_operation);
+  OperationStats stats {};
+  for (ThreadCounters* block = s_blocks.load(std::memory_order_acquire); block; block = block->m_next)
+    {
+      const Counters& counters = block->m_operations[index];
+      stats.m_calls += counters.m_calls.load(std::memory_order_relaxed);
+      stats.m_failures += counters.m_failures.load(std::memory_order_relaxed);
+      stats.m_nanoseconds += counters.m_nanoseconds.load(std::memory_order_relaxed);
+      for (std::size_t b = 0; b < LATENCY_BUCKETS; ++b)
+        stats.m_buckets[b] += counters.m_buckets[b].load(std::memory_order_relaxed);
+    }
+  return stats;
+}
+
+const char* const OPERATION_NAMES[OPERATION_COUNT] = {
+  "addFlight", "tryAddFlights", "deleteFlight", "setFlightStatus", "applyStatusUpdates",
+  "getFlight", "findFlight", "getFlightCount", "getSnapshot", "getAirportFormatted", "copy", "assignment",
+  "isValidNumber", "isValid24Format", "isValidGate", "isValidName", "isValideCode", "isValidStatus"
+};
+
+}
+
+/**
+ * \brief Estimates a latency percentile from the histogram.
+ * \param[in] p_fraction The percentile, between 0 and 1 (0.99 for the 99th).
+ * \return The upper bound, in nanoseconds, of the bucket holding the percentile;
+ *         0 if no call was recorded.
+ */
+std::uint64_t OperationStats::percentile(double p_fraction) const
+{
+  std::uint64_t total = 0;
+  for (std::uint64_t count : m_buckets)
+    total += count;
+  if (total == 0)
+    return 0;
+  std::uint64_t rank = static_cast<std::uint64_t>(p_fraction * (total - 1)) + 1;
+  std::uint64_t seen = 0;
+  for (std::size_t b = 0; b < LATENCY_BUCKETS; ++b)
+    {
+      seen += m_buckets[b];
+      if (seen >= rank)
+        return b == 0 ? 0 : std::uint64_t(1) << b;
+    }
+  return std::uint64_t(1) << (LATENCY_BUCKETS - 1);
+}
+
+/**
+ * \brief Returns the name of an operation as the report shows it.
+ */
+const char* operationName(Operation p_operation)
+{
+  return OPERATION_NAMES[static_cast<std::size_t>(p_operation)];
+}
+
+/**
+ * \brief Starts or stops the recording of the operations.
+ */
+void setMetricsEnabled(bool p_enabled)
+{
+  s_metricsEnabled.store(p_enabled, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Returns the counters of an operation since the last resetMetrics().
+ */
+OperationStats getOperationStats(Operation p_operation)
+{
+  OperationStats stats = sum(p_operation);
+  std::lock_guard<std::mutex> lock(s_baselineMutex);
+  const OperationStats& baseline = s_baseline[static_cast<std::size_t>(p_operation)];
+  stats.m_calls -= baseline.m_calls;
+  stats.m_failures -= baseline.m_failures;
+  stats.m_nanoseconds -= baseline.m_nanoseconds;
+  for (std::size_t b = 0; b < LATENCY_BUCKETS; ++b)
+    stats.m_buckets[b] -= baseline.m_buckets[b];
+  return stats;
+}
+
+/**
+ * \brief Restarts every counter from zero.
+ *
+ * The counters of the threads are not written: the current sums become the
+ * baseline subtracted by getOperationStats().
+ */
+void resetMetrics()
+{
+  std::lock_guard<std::mutex> lock(s_baselineMutex);
+  for (std::size_t i = 0; i < OPERATION_COUNT; ++i)
+    s_baseline[i] = sum(static_cast<Operation>(i));
+}
+
+/**
+ * \brief Formats the counters of the operations called at least once.
+ * \return One line per operation: calls, failures, mean, median, 99th percentile
+ *         and maximum bucket of the latency.
+ */
+std::string metricsReport()
+{
+  std::string report = "operation             calls     failures  mean(ns)  p50(ns)   p99(ns)   max(ns)\n";
+  char line[160];
+  for (std::size_t i = 0; i < OPERATION_COUNT; ++i)
+    {
+      OperationStats stats = getOperationStats(static_cast<Operation>(i));
+      if (stats.m_calls == 0)
+        continue;
+      std::uint64_t max = stats.percentile(1.0);
+      std::snprintf(line, sizeof(line), "%-21s %-9llu %-9llu %-9llu %-9llu %-9llu %llu\n",
+                    operationName(static_cast<Operation>(i)),
+                    static_cast<unsigned long long>(stats.m_calls),
+                    static_cast<unsigned long long>(stats.m_failures),
+                    static_cast<unsigned long long>(stats.m_nanoseconds / stats.m_calls),
+                    static_cast<unsigned long long>(stats.percentile(0.5)),
+                    static_cast<unsigned long long>(stats.percentile(0.99)),
+                    static_cast<unsigned long long>(max));
+      report += line;
+    }
+  return report;
+}
+
+/**
+ * \brief Returns the steady clock, in nanoseconds; never 0.
+ */
+std::uint64_t startTimer()
+{
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()) | 1;
+}
+
+/**
+ * \brief Records a call in the counters of the calling thread.
+ */
+void stopTimer(Operation p_operation, std::uint64_t p_start, bool p_failed)
+{
+  std::uint64_t elapsed = startTimer() - p_start;
+  elapsed = static_cast<std::int64_t>(elapsed) < 0 ? 0 : elapsed;
+  Counters& counters = countersOf(p_operation);
+  increment(counters.m_calls, 1);
+  if (p_failed)
+    increment(counters.m_failures, 1);
+  increment(counters.m_nanoseconds, elapsed);
+  increment(counters.m_buckets[bucketOf(elapsed)], 1);
+}
+
+int uncaughtExceptions()
+{
+  return std::uncaught_exceptions();
+}
+
+}
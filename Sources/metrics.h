@@ -0,0 +1,157 @@
+/**
+ * \file metrics.h
+ * \brief Optional per-operation counters and latency histograms
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * Each public Airport operation and each validator opens an OperationTimer.
+ * While the metrics are disabled (the default) a timer costs one relaxed
+ * load; once setMetricsEnabled(true) is called, the timer records the call,
+ * whether it failed and its latency in the counters of the calling thread.
+ * The threads never share a counter, so recording needs no atomic
+ * read-modify-write; the counters of all the threads are summed when read.
+ *
+ * Compiling with FLIGHT_METRICS=0 removes the timers entirely.
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#ifndef FLIGHT_METRICS
+#  define FLIGHT_METRICS 1
+#endif
+
+namespace util {
+
+/**
+ * \enum Operation
+ * \brief The instrumented operations.
+ */
+enum class Operation : std::uint8_t
+{
+  AddFlight,           ///< Airport::addFlight and Airport::tryAddFlight
+  AddFlights,          ///< Airport::tryAddFlights
+  DeleteFlight,        ///< Airport::deleteFlight and Airport::tryDeleteFlight
+  SetFlightStatus,     ///< Airport::setFlightStatus
+  ApplyStatusUpdates,  ///< Airport::applyStatusUpdates
+  GetFlight,           ///< Airport::getFlight
+  FindFlight,          ///< Airport::findFlight
+  GetFlightCount,      ///< Airport::getFlightCount
+  GetSnapshot,         ///< Airport::getSnapshot
+  AirportFormatted,    ///< Airport::getAirportFormatted
+  CopyAirport,         ///< Airport copy constructor
+  AssignAirport,       ///< Airport assignment
+  ValidateNumber,      ///< isValidNumber
+  Validate24Format,    ///< isValid24Format
+  ValidateGate,        ///< isValidGate
+  ValidateName,        ///< isValidName
+  ValidateCode,        ///< isValideCode
+  ValidateStatus,      ///< isValidStatus
+  Count
+};
+
+const std::size_t OPERATION_COUNT = static_cast<std::size_t>(Operation::Count);
+
+/**
+ * \brief Latency buckets: bucket 0 holds 0 ns, bucket b holds [2^(b-1), 2^b) ns,
+ * the last one everything longer.
+ */
+const std::size_t LATENCY_BUCKETS = 40;
+
+/**
+ * \struct OperationStats
+ * \brief Counters of one operation, summed over all the threads.
+ */
+struct OperationStats
+{
+  std::uint64_t m_calls;
+  std::uint64_t m_failures;
+  std::uint64_t m_nanoseconds;
+  std::array<std::uint64_t, LATENCY_BUCKETS> m_buckets;
+
+  std::uint64_t percentile(double p_fraction) const;
+};
+
+const char* operationName(Operation p_operation);
+void setMetricsEnabled(bool p_enabled);
+OperationStats getOperationStats(Operation p_operation);
+void resetMetrics();
+std::string metricsReport();
+
+std::uint64_t startTimer();
+void stopTimer(Operation p_operation, std::uint64_t p_start, bool p_failed);
+int uncaughtExceptions();
+
+inline std::atomic<bool> s_metricsEnabled {false};
+
+/**
+ * \brief Returns true if the operations are being recorded.
+ */
+inline bool metricsEnabled()
+{
+  return FLIGHT_METRICS && s_metricsEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * \class OperationTimer
+ * \brief Records one call of an operation, from its construction to its destruction.
+ *
+ * The call counts as failed if fail() or result(false) was called, or if the
+ * timer is destroyed by an exception. The timer is a literal type, so it can
+ * be used in the constexpr validators; it records nothing during constant
+ * evaluation.
+ */
+class OperationTimer
+{
+public:
+  constexpr explicit OperationTimer(Operation p_operation)
+      : m_operation(p_operation), m_start(0), m_exceptions(0), m_failed(false)
+  {
+    if (!std::is_constant_evaluated() && metricsEnabled()) [[unlikely]]
+      {
+        m_exceptions = uncaughtExceptions();
+        m_start = startTimer();
+      }
+  }
+
+  constexpr ~OperationTimer()
+  {
+    if (m_start != 0) [[unlikely]]
+      stopTimer(m_operation, m_start, m_failed || uncaughtExceptions() > m_exceptions);
+  }
+
+  OperationTimer(const OperationTimer&) = delete;
+  OperationTimer& operator=(const OperationTimer&) = delete;
+
+  constexpr void fail()
+  {
+    m_failed = true;
+  }
+
+  /**
+   * \brief Marks the call as failed when p_ok is false.
+   * \return p_ok.
+   */
+  constexpr bool result(bool p_ok)
+  {
+    m_failed = !p_ok;
+    return p_ok;
+  }
+
+private:
+  Operation m_operation;
+  std::uint64_t m_start;
+  int m_exceptions;
+  bool m_failed;
+};
+
+}
+
+
+#endif /* METRICS_H */
@@ -0,0 +1,124 @@
+/**
+ * \file mpscQueue.h
+ * \brief Bounded lock-free queue with several producers and one consumer
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * Dmitry Vyukov's bounded queue: every cell carries a sequence number telling
+ * whether it is free for the producer of a given position or ready for the
+ * consumer. A producer claims a position with one compare-and-swap; the only
+ * consumer needs none.
+ */
+
+#ifndef MPSCQUEUE_H
+#define MPSCQUEUE_H
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+namespace util {
+
+/**
+ * \class MpscQueue
+ * \brief Fixed-capacity FIFO; tryPush may be called from any thread, tryPop from one thread only.
+ *
+ * \tparam T A trivially copyable record.
+ */
+template <typename T>
+class MpscQueue
+{
+public:
+  /**
+   * \brief Builds an empty queue.
+   * \param[in] p_capacity The minimum number of records held, rounded up to a power of two.
+   */
+  explicit MpscQueue(std::size_t p_capacity): m_head(0), m_tail(0)
+  {
+    std::size_t capacity = 2;
+    while (capacity < p_capacity)
+      capacity *= 2;
+    m_mask = capacity - 1;
+    m_cells.reset(new Cell[capacity]);
+    for (std::size_t i = 0; i < capacity; ++i)
+      m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+  }
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  /**
+   * \brief Appends a record.
+   * \param[in] p_value The record to append.
+   * \return false if the queue is full.
+   */
+  bool tryPush(const T& p_value)
+  {
+    std::size_t position = m_tail.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;)
+      {
+        cell = &m_cells[position & m_mask];
+        std::size_t sequence = cell->m_sequence.load(std::memory_order_acquire);
+        std::intptr_t difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+        if (difference == 0)
+          {
+            if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+              break;
+          }
+        else if (difference < 0)
+          return false;
+        else
+          position = m_tail.load(std::memory_order_relaxed);
+      }
+    cell->m_value = p_value;
+    cell->m_sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * \brief Removes the oldest record. Only the consumer thread may call it.
+   * \param[out] p_value The record removed.
+   * \return false if no record is ready.
+   */
+  bool tryPop(T& p_value)
+  {
+    Cell& cell = m_cells[m_head & m_mask];
+    std::size_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+    if (static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(m_head + 1) < 0)
+      return false;
+    p_value = cell.m_value;
+    cell.m_sequence.store(m_head + m_mask + 1, std::memory_order_release);
+    ++m_head;
+    return true;
+  }
+
+  /**
+   * \brief Returns the number of records pushed since the creation of the queue.
+   */
+  std::size_t pushedCount() const
+  {
+    return m_tail.load(std::memory_order_acquire);
+  }
+
+  std::size_t capacity() const
+  {
+    return m_mask + 1;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<std::size_t> m_sequence;
+    T m_value;
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  std::size_t m_mask;
+  alignas(64) std::size_t m_head;
+  alignas(64) std::atomic<std::size_t> m_tail;
+};
+
+}
+
+
+#endif /* MPSCQUEUE_H */
@@ -37,9 +37,21 @@ OBJECTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}
 OBJECTFILES= \
 	${OBJECTDIR}/Airport.o \
 	${OBJECTDIR}/Arrival.o \
+	${OBJECTDIR}/BatchSession.o \
 	${OBJECTDIR}/ContratException.o \
 	${OBJECTDIR}/Depart.o \
+	${OBJECTDIR}/Executor.o \
 	${OBJECTDIR}/Flight.o \
+	${OBJECTDIR}/FlightSearchIndex.o \
+	${OBJECTDIR}/MemoryUsage.o \
+	${OBJECTDIR}/ScheduleGenerator.o \
+	${OBJECTDIR}/ScheduleLoader.o \
+	${OBJECTDIR}/StatusFeed.o \
+	${OBJECTDIR}/arenaResource.o \
+	${OBJECTDIR}/batchValidation.o \
+	${OBJECTDIR}/epochReclamation.o \
+	${OBJECTDIR}/metrics.o \
+	${OBJECTDIR}/trace.o \
 	${OBJECTDIR}/validationFormat.o
 
 # Test Directory
@@ -49,22 +61,36 @@ TESTDIR=${CND_BUILDDIR}/${CND_CONF}/${CND_PLATFORM}/tests
 TESTFILES= \
 	${TESTDIR}/TestFiles/f2 \
 	${TESTDIR}/TestFiles/f3 \
+	${TESTDIR}/TestFiles/f11 \
 	${TESTDIR}/TestFiles/f4 \
+	${TESTDIR}/TestFiles/f7 \
+	${TESTDIR}/TestFiles/f10 \
+	${TESTDIR}/TestFiles/f8 \
+	${TESTDIR}/TestFiles/f9 \
+	${TESTDIR}/TestFiles/f6 \
+	${TESTDIR}/TestFiles/f5 \
 	${TESTDIR}/TestFiles/f1
 
 # Test Object Files
 TESTOBJECTFILES= \
 	${TESTDIR}/tests/AeroportTesteur.o \
 	${TESTDIR}/tests/ArriveeTesteur.o \
+	${TESTDIR}/tests/BatchSessionTesteur.o \
 	${TESTDIR}/tests/DepartTesteur.o \
+	${TESTDIR}/tests/ExecutorTesteur.o \
+	${TESTDIR}/tests/FlightSearchIndexTesteur.o \
+	${TESTDIR}/tests/ScheduleGeneratorTesteur.o \
+	${TESTDIR}/tests/ScheduleLoaderTesteur.o \
+	${TESTDIR}/tests/StatusFeedTesteur.o \
+	${TESTDIR}/tests/ValidationFormatTesteur.o \
 	${TESTDIR}/tests/VolTesteur.o
 
 # C Compiler Flags
 CFLAGS=
 
 # CC Compiler Flags
-CCFLAGS=
-CXXFLAGS=
+CCFLAGS=-std=c++20
+CXXFLAGS=-std=c++20
 
 # Fortran Compiler Flags
 FFLAGS=
@@ -95,6 +121,11 @@ ${OBJECTDIR}/Arrival.o: Arrival.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/Arrival.o Arrival.cpp
 
+${OBJECTDIR}/BatchSession.o: BatchSession.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/BatchSession.o BatchSession.cpp
+
 ${OBJECTDIR}/ContratException.o: ContratException.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -105,11 +136,66 @@ ${OBJECTDIR}/Depart.o: Depart.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/Depart.o Depart.cpp
 
+${OBJECTDIR}/Executor.o: Executor.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/Executor.o Executor.cpp
+
 ${OBJECTDIR}/Flight.o: Flight.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/Flight.o Flight.cpp
 
+${OBJECTDIR}/FlightSearchIndex.o: FlightSearchIndex.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/FlightSearchIndex.o FlightSearchIndex.cpp
+
+${OBJECTDIR}/MemoryUsage.o: MemoryUsage.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/MemoryUsage.o MemoryUsage.cpp
+
+${OBJECTDIR}/ScheduleGenerator.o: ScheduleGenerator.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ScheduleGenerator.o ScheduleGenerator.cpp
+
+${OBJECTDIR}/ScheduleLoader.o: ScheduleLoader.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ScheduleLoader.o ScheduleLoader.cpp
+
+${OBJECTDIR}/StatusFeed.o: StatusFeed.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/StatusFeed.o StatusFeed.cpp
+
+${OBJECTDIR}/arenaResource.o: arenaResource.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/arenaResource.o arenaResource.cpp
+
+${OBJECTDIR}/batchValidation.o: batchValidation.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/batchValidation.o batchValidation.cpp
+
+${OBJECTDIR}/epochReclamation.o: epochReclamation.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/epochReclamation.o epochReclamation.cpp
+
+${OBJECTDIR}/metrics.o: metrics.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/metrics.o metrics.cpp
+
+${OBJECTDIR}/trace.o: trace.cpp
+	${MKDIR} -p ${OBJECTDIR}
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/trace.o trace.cpp
+
 ${OBJECTDIR}/validationFormat.o: validationFormat.cpp
 	${MKDIR} -p ${OBJECTDIR}
 	${RM} "$@.d"
@@ -130,10 +216,38 @@ ${TESTDIR}/TestFiles/f3: ${TESTDIR}/tests/ArriveeTesteur.o ${OBJECTFILES:%.o=%_n
 	${MKDIR} -p ${TESTDIR}/TestFiles
 	${LINK.cc} -o ${TESTDIR}/TestFiles/f3 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
 
+${TESTDIR}/TestFiles/f11: ${TESTDIR}/tests/BatchSessionTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f11 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
 ${TESTDIR}/TestFiles/f4: ${TESTDIR}/tests/DepartTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
 	${MKDIR} -p ${TESTDIR}/TestFiles
 	${LINK.cc} -o ${TESTDIR}/TestFiles/f4 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
 
+${TESTDIR}/TestFiles/f7: ${TESTDIR}/tests/ExecutorTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f7 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
+${TESTDIR}/TestFiles/f10: ${TESTDIR}/tests/FlightSearchIndexTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f10 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
+${TESTDIR}/TestFiles/f8: ${TESTDIR}/tests/ScheduleGeneratorTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f8 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
+${TESTDIR}/TestFiles/f9: ${TESTDIR}/tests/ScheduleLoaderTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f9 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
+${TESTDIR}/TestFiles/f6: ${TESTDIR}/tests/StatusFeedTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f6 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
+${TESTDIR}/TestFiles/f5: ${TESTDIR}/tests/ValidationFormatTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
+	${MKDIR} -p ${TESTDIR}/TestFiles
+	${LINK.cc} -o ${TESTDIR}/TestFiles/f5 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
+
 ${TESTDIR}/TestFiles/f1: ${TESTDIR}/tests/VolTesteur.o ${OBJECTFILES:%.o=%_nomain.o}
 	${MKDIR} -p ${TESTDIR}/TestFiles
 	${LINK.cc} -o ${TESTDIR}/TestFiles/f1 $^ ${LDLIBSOPTIONS}   -lgtest_main -lgtest -lpthread 
@@ -151,12 +265,54 @@ ${TESTDIR}/tests/ArriveeTesteur.o: tests/ArriveeTesteur.cpp
 	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/ArriveeTesteur.o tests/ArriveeTesteur.cpp
 
 
+${TESTDIR}/tests/BatchSessionTesteur.o: tests/BatchSessionTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/BatchSessionTesteur.o tests/BatchSessionTesteur.cpp
+
+
 ${TESTDIR}/tests/DepartTesteur.o: tests/DepartTesteur.cpp 
 	${MKDIR} -p ${TESTDIR}/tests
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/DepartTesteur.o tests/DepartTesteur.cpp
 
 
+${TESTDIR}/tests/ExecutorTesteur.o: tests/ExecutorTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/ExecutorTesteur.o tests/ExecutorTesteur.cpp
+
+
+${TESTDIR}/tests/FlightSearchIndexTesteur.o: tests/FlightSearchIndexTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/FlightSearchIndexTesteur.o tests/FlightSearchIndexTesteur.cpp
+
+
+${TESTDIR}/tests/ScheduleGeneratorTesteur.o: tests/ScheduleGeneratorTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/ScheduleGeneratorTesteur.o tests/ScheduleGeneratorTesteur.cpp
+
+
+${TESTDIR}/tests/ScheduleLoaderTesteur.o: tests/ScheduleLoaderTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/ScheduleLoaderTesteur.o tests/ScheduleLoaderTesteur.cpp
+
+
+${TESTDIR}/tests/StatusFeedTesteur.o: tests/StatusFeedTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/StatusFeedTesteur.o tests/StatusFeedTesteur.cpp
+
+
+${TESTDIR}/tests/ValidationFormatTesteur.o: tests/ValidationFormatTesteur.cpp 
+	${MKDIR} -p ${TESTDIR}/tests
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -I/usr/src/gtest/include -I. -MMD -MP -MF "$@.d" -o ${TESTDIR}/tests/ValidationFormatTesteur.o tests/ValidationFormatTesteur.cpp
+
+
 ${TESTDIR}/tests/VolTesteur.o: tests/VolTesteur.cpp 
 	${MKDIR} -p ${TESTDIR}/tests
 	${RM} "$@.d"
@@ -189,6 +345,19 @@ ${OBJECTDIR}/Arrival_nomain.o: ${OBJECTDIR}/Arrival.o Arrival.cpp
 	    ${CP} ${OBJECTDIR}/Arrival.o ${OBJECTDIR}/Arrival_nomain.o;\
 	fi
 
+${OBJECTDIR}/BatchSession_nomain.o: ${OBJECTDIR}/BatchSession.o BatchSession.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/BatchSession.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/BatchSession_nomain.o BatchSession.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/BatchSession.o ${OBJECTDIR}/BatchSession_nomain.o;\
+	fi
+
 ${OBJECTDIR}/ContratException_nomain.o: ${OBJECTDIR}/ContratException.o ContratException.cpp 
 	${MKDIR} -p ${OBJECTDIR}
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/ContratException.o`; \
@@ -215,6 +384,19 @@ ${OBJECTDIR}/Depart_nomain.o: ${OBJECTDIR}/Depart.o Depart.cpp
 	    ${CP} ${OBJECTDIR}/Depart.o ${OBJECTDIR}/Depart_nomain.o;\
 	fi
 
+${OBJECTDIR}/Executor_nomain.o: ${OBJECTDIR}/Executor.o Executor.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/Executor.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/Executor_nomain.o Executor.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/Executor.o ${OBJECTDIR}/Executor_nomain.o;\
+	fi
+
 ${OBJECTDIR}/Flight_nomain.o: ${OBJECTDIR}/Flight.o Flight.cpp 
 	${MKDIR} -p ${OBJECTDIR}
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/Flight.o`; \
@@ -228,6 +410,136 @@ ${OBJECTDIR}/Flight_nomain.o: ${OBJECTDIR}/Flight.o Flight.cpp
 	    ${CP} ${OBJECTDIR}/Flight.o ${OBJECTDIR}/Flight_nomain.o;\
 	fi
 
+${OBJECTDIR}/FlightSearchIndex_nomain.o: ${OBJECTDIR}/FlightSearchIndex.o FlightSearchIndex.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/FlightSearchIndex.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/FlightSearchIndex_nomain.o FlightSearchIndex.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/FlightSearchIndex.o ${OBJECTDIR}/FlightSearchIndex_nomain.o;\
+	fi
+
+${OBJECTDIR}/MemoryUsage_nomain.o: ${OBJECTDIR}/MemoryUsage.o MemoryUsage.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/MemoryUsage.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/MemoryUsage_nomain.o MemoryUsage.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/MemoryUsage.o ${OBJECTDIR}/MemoryUsage_nomain.o;\
+	fi
+
+${OBJECTDIR}/ScheduleGenerator_nomain.o: ${OBJECTDIR}/ScheduleGenerator.o ScheduleGenerator.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/ScheduleGenerator.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ScheduleGenerator_nomain.o ScheduleGenerator.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/ScheduleGenerator.o ${OBJECTDIR}/ScheduleGenerator_nomain.o;\
+	fi
+
+${OBJECTDIR}/ScheduleLoader_nomain.o: ${OBJECTDIR}/ScheduleLoader.o ScheduleLoader.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/ScheduleLoader.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/ScheduleLoader_nomain.o ScheduleLoader.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/ScheduleLoader.o ${OBJECTDIR}/ScheduleLoader_nomain.o;\
+	fi
+
+${OBJECTDIR}/StatusFeed_nomain.o: ${OBJECTDIR}/StatusFeed.o StatusFeed.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/StatusFeed.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/StatusFeed_nomain.o StatusFeed.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/StatusFeed.o ${OBJECTDIR}/StatusFeed_nomain.o;\
+	fi
+
+${OBJECTDIR}/arenaResource_nomain.o: ${OBJECTDIR}/arenaResource.o arenaResource.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/arenaResource.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/arenaResource_nomain.o arenaResource.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/arenaResource.o ${OBJECTDIR}/arenaResource_nomain.o;\
+	fi
+
+${OBJECTDIR}/batchValidation_nomain.o: ${OBJECTDIR}/batchValidation.o batchValidation.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/batchValidation.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/batchValidation_nomain.o batchValidation.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/batchValidation.o ${OBJECTDIR}/batchValidation_nomain.o;\
+	fi
+
+${OBJECTDIR}/epochReclamation_nomain.o: ${OBJECTDIR}/epochReclamation.o epochReclamation.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/epochReclamation.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/epochReclamation_nomain.o epochReclamation.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/epochReclamation.o ${OBJECTDIR}/epochReclamation_nomain.o;\
+	fi
+
+${OBJECTDIR}/metrics_nomain.o: ${OBJECTDIR}/metrics.o metrics.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/metrics.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/metrics_nomain.o metrics.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/metrics.o ${OBJECTDIR}/metrics_nomain.o;\
+	fi
+
+${OBJECTDIR}/trace_nomain.o: ${OBJECTDIR}/trace.o trace.cpp 
+	${MKDIR} -p ${OBJECTDIR}
+	@NMOUTPUT=`${NM} ${OBJECTDIR}/trace.o`; \
+	if (echo "$$NMOUTPUT" | ${GREP} '|main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T main$$') || \
+	   (echo "$$NMOUTPUT" | ${GREP} 'T _main$$'); \
+	then  \
+	    ${RM} "$@.d";\
+	    $(COMPILE.cc) -g -Dmain=__nomain -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/trace_nomain.o trace.cpp;\
+	else  \
+	    ${CP} ${OBJECTDIR}/trace.o ${OBJECTDIR}/trace_nomain.o;\
+	fi
+
 ${OBJECTDIR}/validationFormat_nomain.o: ${OBJECTDIR}/validationFormat.o validationFormat.cpp 
 	${MKDIR} -p ${OBJECTDIR}
 	@NMOUTPUT=`${NM} ${OBJECTDIR}/validationFormat.o`; \
@@ -247,7 +559,14 @@ ${OBJECTDIR}/validationFormat_nomain.o: ${OBJECTDIR}/validationFormat.o validati
 	then  \
 	    ${TESTDIR}/TestFiles/f2 || true; \
 	    ${TESTDIR}/TestFiles/f3 || true; \
+	    ${TESTDIR}/TestFiles/f11 || true; \
 	    ${TESTDIR}/TestFiles/f4 || true; \
+	    ${TESTDIR}/TestFiles/f7 || true; \
+	    ${TESTDIR}/TestFiles/f10 || true; \
+	    ${TESTDIR}/TestFiles/f8 || true; \
+	    ${TESTDIR}/TestFiles/f9 || true; \
+	    ${TESTDIR}/TestFiles/f6 || true; \
+	    ${TESTDIR}/TestFiles/f5 || true; \
 	    ${TESTDIR}/TestFiles/f1 || true; \
 	else  \
 	    ./${TEST} || true; \
@@ -0,0 +1,79 @@
+/**
+ * \file sharedMutex.h
+ * \brief Reader/writer mutex that does not let a stream of readers starve the writers
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ */
+
+#ifndef SHAREDMUTEX_H
+#define SHAREDMUTEX_H
+#include <mutex>
+#include <shared_mutex>
+namespace util {
+
+/**
+ * \class SharedMutex
+ * \brief std::shared_mutex with writer preference.
+ *
+ * The glibc rwlock behind std::shared_mutex prefers the readers: with a few
+ * threads rendering in a loop, a writer may never get in. Here a writer holds
+ * a gate while it waits for the current readers to leave, and new readers
+ * have to pass the gate, so they queue behind the writer.
+ * It meets the SharedMutex requirements (std::shared_lock, std::unique_lock, std::lock).
+ */
+class SharedMutex
+{
+public:
+  SharedMutex() = default;
+  SharedMutex(const SharedMutex&) = delete;
+  SharedMutex& operator=(const SharedMutex&) = delete;
+
+  void lock()
+  {
+    std::lock_guard<std::mutex> gate(m_gate);
+    m_shared.lock();
+  }
+
+  bool try_lock()
+  {
+    std::unique_lock<std::mutex> gate(m_gate, std::try_to_lock);
+    return gate.owns_lock() && m_shared.try_lock();
+  }
+
+  void unlock()
+  {
+    m_shared.unlock();
+  }
+
+  void lock_shared()
+  {
+    {
+      std::lock_guard<std::mutex> gate(m_gate);
+    }
+    m_shared.lock_shared();
+  }
+
+  bool try_lock_shared()
+  {
+    {
+      std::unique_lock<std::mutex> gate(m_gate, std::try_to_lock);
+      if (!gate.owns_lock())
+        return false;
+    }
+    return m_shared.try_lock_shared();
+  }
+
+  void unlock_shared()
+  {
+    m_shared.unlock_shared();
+  }
+
+private:
+  std::mutex m_gate;
+  std::shared_mutex m_shared;
+};
+
+}
+
+
+#endif /* SHAREDMUTEX_H */
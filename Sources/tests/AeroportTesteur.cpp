@@ -6,11 +6,25 @@
  */
 #include <gtest/gtest.h>
 #include "Airport.h"
+#include "arenaResource.h"
 #include "Arrival.h"
 #include "Depart.h"
 #include "Flight.h"
 #include "ContratException.h"
 #include "FlightException.h"
+#include "epochReclamation.h"
+#include "metrics.h"
+#include "trace.h"
+#include <atomic>
+#include <chrono>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include <iomanip>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <thread>
 #include <vector>
 
 using namespace aerien;
@@ -82,6 +96,46 @@ TEST(Airport, AssignmentOperator) {
     ASSERT_EQ(airport1.getAirportFormatted (), airport2.getAirportFormatted ());
 }
 
+/**
+ * \brief Test of the move constructor: the flights and their handles are taken over.
+ */
+TEST(Airport, MoveConstructor) {
+    Airport airport1("YUL");
+    FlightId id;
+    airport1.tryAddFlight(Arrival("RJ0271","ROYAL JORDANIAN","07:12","AMMAN"," Atterri "), &id);
+    airport1.addFlight(Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+    string board = airport1.getAirportFormatted ();
+    shared_ptr<const Flight> flight = airport1.getFlight(id);
+
+    Airport airport2(std::move(airport1));
+    ASSERT_EQ(board, airport2.getAirportFormatted ());
+    ASSERT_EQ(flight, airport2.getFlight(id));
+    ASSERT_EQ(0u, airport1.getFlightCount ());
+    ASSERT_EQ(0u, airport1.getSnapshot()->m_flights.size());
+    airport1.addFlight(Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+    ASSERT_EQ(1u, airport1.getFlightCount ());
+}
+
+/**
+ * \brief Test of the move assignment: the flights are shared, not copied.
+ */
+TEST(Airport, MoveAssignment) {
+    Airport airport1("YUL");
+    airport1.addFlight(Arrival("RJ0271","ROYAL JORDANIAN","07:12","AMMAN"," Atterri "));
+    shared_ptr<const Flight> flight = airport1.getFlight(airport1.findFlight("RJ0271"));
+    string board = airport1.getAirportFormatted ();
+    Airport airport2("YYZ");
+    FlightId former;
+    airport2.tryAddFlight(Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"), &former);
+
+    airport2 = std::move(airport1);
+    ASSERT_EQ("YUL", airport2.getCode ());
+    ASSERT_EQ(board, airport2.getAirportFormatted ());
+    ASSERT_EQ(flight, airport2.getFlight(airport2.findFlight("RJ0271")));
+    ASSERT_EQ(nullptr, airport2.getFlight(former));
+    ASSERT_EQ(0u, airport1.getFlightCount ());
+}
+
 /**
  * \brief Test of the getAirportFormatted() method.
  *
@@ -211,4 +265,801 @@ TEST_F(TheAirport, Delete_invalid_Flight)
     f_Airport.addFlight(aerien::Arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
     
     ASSERT_THROW(f_Airport.deleteFlight("LH0792568"), PreconditionException);
-}
\ No newline at end of file
+}
+/**
+ * @brief Tests the result codes of tryAddFlight.
+ * A first flight is accepted, a second one with the same number is reported
+ * as AlreadyExists and does not change the airport.
+ */
+TEST_F(TheAirport, TryAddFlight)
+{
+    ASSERT_EQ(FlightResult::Ok,
+              f_Airport.tryAddFlight(aerien::Arrival("LH0478", "LUFTHANSA", "22:05", "MUNICH", " Retardé ")));
+    string before = f_Airport.getAirportFormatted ();
+
+    ASSERT_EQ(FlightResult::AlreadyExists,
+              f_Airport.tryAddFlight(aerien::Arrival("LH0478", "ABCDE", "11:11", "AZERTY", " Retardé ")));
+    ASSERT_EQ(before, f_Airport.getAirportFormatted ());
+}
+
+/**
+ * @brief Tests the result codes of tryDeleteFlight.
+ */
+TEST_F(TheAirport, TryDeleteFlight)
+{
+    f_Airport.addFlight(aerien::Arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
+
+    ASSERT_EQ(FlightResult::InvalidNumber, f_Airport.tryDeleteFlight("LH0792568"));
+    ASSERT_EQ(FlightResult::Absent, f_Airport.tryDeleteFlight("LH0792"));
+    ASSERT_EQ(FlightResult::Ok, f_Airport.tryDeleteFlight("LH0478"));
+    ASSERT_EQ(FlightResult::Absent, f_Airport.tryDeleteFlight("LH0478"));
+    ASSERT_EQ(std::string::npos, f_Airport.getAirportFormatted ().find("LH0478"));
+}
+
+/**
+ * @brief Tests setFlightStatus and getFlight.
+ */
+TEST_F(TheAirport, SetFlightStatus)
+{
+    f_Airport.addFlight(aerien::Arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
+    f_Airport.addFlight(aerien::Depart("AC1636","AIR CANADA","18:00","ORLONDO","17:15","C86"));
+
+    ASSERT_EQ(FlightResult::Ok, f_Airport.setFlightStatus("LH0478", " Atterri "));
+    ASSERT_EQ(FlightResult::NotArrival, f_Airport.setFlightStatus("AC1636", " Atterri "));
+    ASSERT_EQ(FlightResult::Absent, f_Airport.setFlightStatus("LH0792", " Atterri "));
+    ASSERT_EQ(FlightResult::InvalidStatus, f_Airport.setFlightStatus("LH0478", "Landed"));
+
+    unique_ptr<Flight> flight = f_Airport.getFlight("LH0478");
+    ASSERT_NE(nullptr, flight);
+    ASSERT_EQ(" Atterri ", dynamic_cast<Arrival&>(*flight).getStatus());
+    ASSERT_EQ(nullptr, f_Airport.getFlight("LH0792"));
+    ASSERT_EQ(2u, f_Airport.getFlightCount());
+}
+
+/**
+ * @brief Stress test: a status feed and an add/delete writer run against
+ * several rendering threads.
+ *
+ * Every board seen by a reader must be complete: all the arrivals listed,
+ * each with a valid status, and no torn row.
+ */
+TEST_F(TheAirport, ConcurrentReadersAndWriters)
+{
+    const int arrivals = 20;
+    const int rounds = 2000;
+    for (int i = 0; i < arrivals; ++i)
+    {
+        f_Airport.addFlight(aerien::Arrival("LH" + to_string(1000 + i), "LUFTHANSA", "22:05", "MUNICH",
+                                            " Retardé "));
+    }
+
+    atomic<bool> done(false);
+    atomic<int> errors(0);
+    vector<thread> threads;
+    threads.emplace_back([&]
+    {
+        const string statuses[] = {" Atterri ", " Retardé ", "À l'heure"};
+        for (int r = 0; r < rounds; ++r)
+        {
+            if (f_Airport.setFlightStatus("LH" + to_string(1000 + r % arrivals), statuses[r % 3])
+                != FlightResult::Ok)
+                ++errors;
+        }
+    });
+    threads.emplace_back([&]
+    {
+        aerien::Depart depart("AC1636","AIR CANADA","18:00","ORLONDO","17:15","C86");
+        for (int r = 0; r < rounds; ++r)
+        {
+            if (f_Airport.tryAddFlight(depart) != FlightResult::Ok
+                || f_Airport.tryDeleteFlight("AC1636") != FlightResult::Ok)
+                ++errors;
+        }
+    });
+    for (int reader = 0; reader < 4; ++reader)
+    {
+        threads.emplace_back([&]
+        {
+            while (!done)
+            {
+                istringstream board(f_Airport.getAirportFormatted ());
+                int rows = 0;
+                for (string line; getline(board, line); )
+                {
+                    if (line.compare(0, 3, "|LH") == 0)
+                    {
+                        ++rows;
+                        if (line.find("Atterri") == string::npos && line.find("Retard") == string::npos
+                            && line.find("l'heure") == string::npos)
+                            ++errors;
+                    }
+                }
+                if (rows != arrivals)
+                    ++errors;
+                if (f_Airport.getFlight("LH1000") == nullptr)
+                    ++errors;
+            }
+        });
+    }
+    threads[0].join();
+    threads[1].join();
+    done = true;
+    for (size_t i = 2; i < threads.size(); ++i)
+        threads[i].join();
+
+    ASSERT_EQ(0, errors.load());
+    ASSERT_EQ(static_cast<size_t>(arrivals), f_Airport.getFlightCount());
+}
+
+/**
+ * @brief Tests that the board lists the flights in insertion order, whatever their shards.
+ */
+TEST_F(TheAirport, InsertionOrderAcrossShards)
+{
+    vector<string> numbers;
+    for (int i = 0; i < 200; ++i)
+    {
+        numbers.push_back(string(1, 'A' + (i * 7) % 26) + "Z" + to_string(9999 - i * 37));
+        f_Airport.addFlight(aerien::Arrival(numbers.back(), "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+    }
+    f_Airport.deleteFlight(numbers[10]);
+
+    string board = f_Airport.getAirportFormatted ();
+    size_t position = 0;
+    for (int i = 0; i < 200; ++i)
+    {
+        size_t found = board.find("|" + numbers[i] + "|");
+        if (i == 10)
+        {
+            ASSERT_EQ(string::npos, found);
+            continue;
+        }
+        ASSERT_NE(string::npos, found) << numbers[i];
+        ASSERT_LT(position, found) << numbers[i];
+        position = found;
+    }
+}
+
+/**
+ * @brief Tests that a FlightId keeps designating its flight across the other
+ * deletions, and nothing once its flight is deleted, even when its slot is reused.
+ */
+TEST_F(TheAirport, FlightIds)
+{
+    FlightId first;
+    FlightId second;
+    ASSERT_EQ(FlightResult::Ok, f_Airport.tryAddFlight(aerien::Arrival("LH0478", "LUFTHANSA", "22:05", "MUNICH", " Retardé "), &first));
+    ASSERT_EQ(FlightResult::Ok, f_Airport.tryAddFlight(aerien::Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"), &second));
+    ASSERT_FALSE(first.isNull());
+    ASSERT_EQ(first, f_Airport.findFlight("LH0478"));
+    ASSERT_TRUE(f_Airport.findFlight("LH0792").isNull());
+    ASSERT_TRUE(f_Airport.findFlight("LH0792568").isNull());
+
+    Airport::Snapshot snapshot = f_Airport.getSnapshot();
+    ASSERT_EQ(snapshot->m_flights.size(), snapshot->m_ids.size());
+    ASSERT_EQ(first, snapshot->m_ids[0]);
+    ASSERT_EQ(snapshot->m_flights[1], f_Airport.getFlight(second));
+
+    ASSERT_EQ(FlightResult::Ok, f_Airport.setFlightStatus(first, " Atterri "));
+    ASSERT_EQ(FlightResult::NotArrival, f_Airport.setFlightStatus(second, " Atterri "));
+    ASSERT_EQ(" Atterri ", static_cast<const aerien::Arrival&>(*f_Airport.getFlight(first)).getStatus());
+
+    ASSERT_EQ(FlightResult::Ok, f_Airport.tryDeleteFlight(first));
+    ASSERT_EQ(FlightResult::Absent, f_Airport.tryDeleteFlight(first));
+    ASSERT_EQ(nullptr, f_Airport.getFlight(first));
+    ASSERT_EQ("AC1636", f_Airport.getFlight(second)->getNumber());
+
+    // the freed slot is reused by the next flight of the shard, under a new generation
+    FlightId reused;
+    ASSERT_EQ(FlightResult::Ok, f_Airport.tryAddFlight(aerien::Arrival("LH0478", "LUFTHANSA", "23:05", "MUNICH", " Retardé "), &reused));
+    ASSERT_NE(first, reused);
+    ASSERT_EQ(nullptr, f_Airport.getFlight(first));
+    ASSERT_EQ(FlightResult::Absent, f_Airport.setFlightStatus(first, " Atterri "));
+    ASSERT_EQ("23:05", f_Airport.getFlight(reused)->getHour());
+
+    f_Airport = Airport("YUL");
+    ASSERT_EQ(nullptr, f_Airport.getFlight(reused));
+    ASSERT_EQ(nullptr, f_Airport.getFlight(FlightId()));
+}
+
+/**
+ * @brief Stress test: 16 ingest threads add and delete their own flights
+ * while a reader renders the board.
+ */
+TEST_F(TheAirport, ConcurrentIngest)
+{
+    const int writers = 16;
+    const int flights = 100;
+    atomic<bool> done(false);
+    atomic<int> errors(0);
+    vector<thread> threads;
+    for (int w = 0; w < writers; ++w)
+    {
+        threads.emplace_back([&, w]
+        {
+            string prefix(1, 'A' + w);
+            for (int i = 0; i < flights; ++i)
+            {
+                string number = prefix + "B" + to_string(1000 + i);
+                if (f_Airport.tryAddFlight(aerien::Arrival(number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "))
+                    != FlightResult::Ok)
+                    ++errors;
+                if (i % 2 == 0 && f_Airport.tryDeleteFlight(number) != FlightResult::Ok)
+                    ++errors;
+            }
+        });
+    }
+    thread reader([&]
+    {
+        while (!done)
+        {
+            if (f_Airport.getAirportFormatted ().find("Arrivals schedule") == string::npos)
+                ++errors;
+        }
+    });
+    for (thread& writer : threads)
+        writer.join();
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(0, errors.load());
+    ASSERT_EQ(static_cast<size_t>(writers * flights / 2), f_Airport.getFlightCount());
+}
+
+/**
+ * @brief Tests that a snapshot keeps the board of its time while writers publish new ones.
+ */
+TEST_F(TheAirport, SnapshotIsStable)
+{
+    f_Airport.addFlight(aerien::Arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
+    Airport::Snapshot before = f_Airport.getSnapshot();
+
+    f_Airport.setFlightStatus("LH0478", " Atterri ");
+    f_Airport.addFlight(aerien::Depart("AC1636","AIR CANADA","18:00","ORLONDO","17:15","C86"));
+
+    ASSERT_EQ(1u, before->m_flights.size());
+    ASSERT_EQ(" Retardé ", dynamic_cast<const Arrival&>(*before->m_flights[0]).getStatus());
+
+    Airport::Snapshot after = f_Airport.getSnapshot();
+    ASSERT_LT(before->m_version, after->m_version);
+    ASSERT_EQ(2u, after->m_flights.size());
+    ASSERT_EQ(" Atterri ", dynamic_cast<const Arrival&>(*after->m_flights[0]).getStatus());
+    ASSERT_EQ("YUL", after->m_code);
+}
+
+/**
+ * @brief Tests that a thread reads its own mutations at once, whatever the publication task does.
+ */
+TEST_F(TheAirport, ReadsOwnMutations)
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        string number = "LH" + to_string(1000 + i);
+        f_Airport.addFlight(aerien::Arrival(number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+        ASSERT_NE(string::npos, f_Airport.getAirportFormatted().find(number)) << i;
+        Airport copy(f_Airport);
+        ASSERT_EQ(static_cast<size_t>(i + 1), copy.getSnapshot()->m_flights.size());
+        ASSERT_EQ(FlightResult::Ok, f_Airport.setFlightStatus(number, " Atterri "));
+        ASSERT_EQ(" Atterri ", dynamic_cast<const Arrival&>(*f_Airport.getSnapshot()->m_flights[i]).getStatus());
+    }
+}
+
+/**
+ * @brief Tests that the boards derived from the previous ones list the flights of a board built from scratch.
+ */
+TEST_F(TheAirport, IncrementalBoards)
+{
+    mt19937 random(7);
+    vector<string> numbers;
+    for (int i = 0; i < 3000; ++i)
+    {
+        numbers.push_back(string(1, 'A' + i % 26) + string(1, 'A' + i / 26 % 26) + to_string(1000 + i / 676));
+    }
+    for (int round = 0; round < 40; ++round)
+    {
+        for (int i = 0; i < 200; ++i)
+        {
+            const string& number = numbers[random() % numbers.size()];
+            switch (random() % 4)
+            {
+                case 0:
+                    f_Airport.tryAddFlight(aerien::Depart(number, "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+                    break;
+                case 1:
+                    f_Airport.tryAddFlight(aerien::Arrival(number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+                    break;
+                case 2:
+                    f_Airport.tryDeleteFlight(number);
+                    break;
+                default:
+                    f_Airport.setFlightStatus(number, round % 2 ? " Atterri " : "À l'heure");
+                    break;
+            }
+        }
+        if (round % 10 == 9)
+        {
+            Airport moved(std::move(f_Airport));
+            f_Airport = moved;
+        }
+        Airport rebuilt(f_Airport);
+        Airport::Snapshot board = f_Airport.getSnapshot();
+        Airport::Snapshot expected = rebuilt.getSnapshot();
+        ASSERT_EQ(f_Airport.getFlightCount(), board->m_flights.size());
+        ASSERT_EQ(expected->m_flights, board->m_flights) << round;
+        ASSERT_EQ(expected->m_sequences, board->m_sequences) << round;
+        for (size_t i = 0; i < board->m_flights.size(); ++i)
+        {
+            ASSERT_EQ(board->m_flights[i], f_Airport.getFlight(board->m_ids[i]));
+        }
+    }
+}
+
+namespace
+{
+    atomic<int> s_reclaimed(0);
+}
+
+/**
+ * @brief Tests that a retired object is only deleted once no guard can see it.
+ */
+TEST(EpochReclamation, RetiredObjectOutlivesGuard)
+{
+    s_reclaimed = 0;
+    {
+        util::EpochGuard guard;
+        util::retire(&s_reclaimed, [](void*) { ++s_reclaimed; });
+        util::reclaim();
+        util::reclaim();
+        ASSERT_EQ(0, s_reclaimed.load());
+    }
+    util::reclaim();
+    ASSERT_EQ(1, s_reclaimed.load());
+}
+
+/**
+ * @brief Tests that snapshots can be held by more threads at once than the first block of reader slots.
+ */
+TEST_F(TheAirport, SnapshotsOnManyThreads)
+{
+    f_Airport.addFlight(aerien::Arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
+    const int threadCount = 600;
+    atomic<int> holding(0);
+    atomic<int> errors(0);
+    vector<thread> readers;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        readers.emplace_back([this, &holding, &errors]
+        {
+            Airport::Snapshot snapshot = f_Airport.getSnapshot();
+            ++holding;
+            while (holding.load() < threadCount)
+                this_thread::yield();
+            if (snapshot->m_flights.size() != 1)
+                ++errors;
+        });
+    }
+    for (thread& reader : readers)
+        reader.join();
+    ASSERT_EQ(0, errors.load());
+}
+
+namespace
+{
+    /**
+     * @brief Serial rendering of a board, as getAirportFormatted used to do it.
+     */
+    string referenceBoard(const Airport::Board& p_board)
+    {
+        ostringstream osDeparture;
+        ostringstream osArrival;
+        osDeparture << "Departure schedule\n";
+        osDeparture << "------------------------------------------------------------------\n";
+        osDeparture << "| FLIGHT  |  COMPANY       |HOUR|         CITY       |EMBRQ|GATE |\n";
+        osDeparture << "------------------------------------------------------------------\n";
+        osArrival <<"Arrivals schedule\n";
+        osArrival <<"----------------------------------------------------------------\n";
+        osArrival <<"|FLIGHT|     COMPANY       |HOUR|        CITY        |  STATUT |\n";
+        osArrival <<"----------------------------------------------------------------\n";
+        for (const auto& flight : p_board.m_flights)
+        {
+            string flight_Info = flight->getFlightFormatted();
+            if (flight_Info.length() == 66)
+                osDeparture << flight_Info << endl;
+            else if (flight_Info.length() == 64 || flight_Info.length() == 65)
+                osArrival << flight_Info << endl;
+        }
+        osDeparture << "------------------------------------------------------------------\n";
+        osArrival << "----------------------------------------------------------------\n";
+        ostringstream osFinal;
+        osFinal << "Airport " << p_board.m_code << "\n\n" << osDeparture.str() << osArrival.str();
+        return osFinal.str();
+    }
+}
+
+/**
+ * @brief Tests that the parallel rendering gives exactly the serial text.
+ */
+TEST_F(TheAirport, ParallelRenderingIsIdentical)
+{
+    const string statuses[] = {" Atterri ", " Retardé ", "À l'heure"};
+    for (int i = 0; i < 3 * static_cast<int>(Airport::PARALLEL_RENDER_ROWS) + 17; ++i)
+    {
+        string number = string(1, 'A' + i % 26) + string(1, 'A' + i / 26 % 26) + to_string(1000 + i / 676);
+        if (i % 3 == 0)
+            f_Airport.tryAddFlight(aerien::Depart(number, "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+        else
+            f_Airport.tryAddFlight(aerien::Arrival(number, "LUFTHANSA", "22:05", "MUNICH", statuses[i % 3]));
+    }
+    Airport::Snapshot board = f_Airport.getSnapshot();
+    string expected = referenceBoard(*board);
+
+    ASSERT_EQ(expected, f_Airport.getAirportFormatted ());
+    for (size_t threads : {1, 2, 3, 7, 64})
+    {
+        ASSERT_EQ(expected, Airport::formatBoard(*board, threads)) << threads << " threads";
+    }
+}
+
+/**
+ * @brief Tests that the streamed board is the formatted one, for an empty board
+ *        and for one spanning several blocks of rows.
+ */
+TEST_F(TheAirport, WriteBoard)
+{
+    ostringstream empty;
+    Airport::writeBoard(empty, *f_Airport.getSnapshot());
+    ASSERT_EQ(f_Airport.getAirportFormatted(), empty.str());
+
+    for (int i = 0; i < 2 * static_cast<int>(Airport::PARALLEL_RENDER_ROWS) + 5; ++i)
+    {
+        string number = string(1, 'A' + i % 26) + string(1, 'A' + i / 26 % 26) + to_string(1000 + i / 676);
+        if (i % 2 == 0)
+            f_Airport.tryAddFlight(aerien::Depart(number, "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+        else
+            f_Airport.tryAddFlight(aerien::Arrival(number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+    }
+    ostringstream os;
+    Airport::writeBoard(os, *f_Airport.getSnapshot());
+    ASSERT_EQ(f_Airport.getAirportFormatted(), os.str());
+}
+
+/**
+ * @brief Tests the rendering of an empty board with several threads.
+ */
+TEST_F(TheAirport, ParallelRenderingOfEmptyBoard)
+{
+    Airport::Snapshot board = f_Airport.getSnapshot();
+    ASSERT_EQ(referenceBoard(*board), Airport::formatBoard(*board, 4));
+}
+
+/**
+ * @brief Tests the bulk addition: results per flight and insertion order kept.
+ */
+TEST_F(TheAirport, TryAddFlights)
+{
+    f_Airport.addFlight(aerien::Arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
+    vector<unique_ptr<Flight>> flights;
+    for (int i = 0; i < 5000; ++i)
+    {
+        string number = string(1, 'A' + i % 26) + string(1, 'A' + i / 26 % 26) + to_string(1000 + i / 676);
+        flights.push_back(make_unique<aerien::Depart>(number, "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+    }
+    flights.push_back(make_unique<aerien::Arrival>("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé "));
+    flights.push_back(make_unique<aerien::Depart>("AA1000", "DELTA", "18:00", "ORLONDO", "17:15", "C86"));
+    vector<const Flight*> pointers;
+    for (const auto& flight : flights)
+        pointers.push_back(flight.get());
+
+    vector<FlightResult> results = f_Airport.tryAddFlights(pointers);
+    ASSERT_EQ(pointers.size(), results.size());
+    for (int i = 0; i < 5000; ++i)
+        ASSERT_EQ(FlightResult::Ok, results[i]) << i;
+    ASSERT_EQ(FlightResult::AlreadyExists, results[5000]);
+    ASSERT_EQ(FlightResult::AlreadyExists, results[5001]);
+    ASSERT_EQ(5001u, f_Airport.getFlightCount());
+
+    Airport::Snapshot board = f_Airport.getSnapshot();
+    ASSERT_EQ("LH0478", board->m_flights[0]->getNumber());
+    for (int i = 0; i < 5000; ++i)
+        ASSERT_EQ(flights[i]->getNumber(), board->m_flights[i + 1]->getNumber());
+    ASSERT_EQ("AIR CANADA", f_Airport.getFlight("AA1000")->getCompany());
+}
+
+/**
+ * @brief Tests the metrics: calls, failures and latencies are recorded only while enabled.
+ */
+TEST_F(TheAirport, Metrics)
+{
+    using util::Operation;
+    aerien::Arrival arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé ");
+    util::resetMetrics();
+    f_Airport.addFlight(arrival);
+    ASSERT_EQ(0u, util::getOperationStats(Operation::AddFlight).m_calls);
+
+    util::setMetricsEnabled(true);
+    f_Airport.deleteFlight("LH0478");
+    f_Airport.addFlight(arrival);
+    ASSERT_THROW(f_Airport.addFlight(arrival), FlightAlreadyExistsException);
+    ASSERT_EQ(nullptr, f_Airport.getFlight("AC1636"));
+    string board = f_Airport.getAirportFormatted();
+    util::setMetricsEnabled(false);
+    f_Airport.deleteFlight("LH0478");
+
+    util::OperationStats adds = util::getOperationStats(Operation::AddFlight);
+    ASSERT_EQ(2u, adds.m_calls);
+    ASSERT_EQ(1u, adds.m_failures);
+    ASSERT_EQ(2u, accumulate(adds.m_buckets.begin(), adds.m_buckets.end(), uint64_t(0)));
+    ASSERT_LE(adds.percentile(0.5), adds.percentile(0.99));
+    ASSERT_EQ(1u, util::getOperationStats(Operation::DeleteFlight).m_calls);
+    ASSERT_EQ(1u, util::getOperationStats(Operation::GetFlight).m_failures);
+    ASSERT_EQ(1u, util::getOperationStats(Operation::AirportFormatted).m_calls);
+
+    string report = util::metricsReport();
+    ASSERT_NE(string::npos, report.find("addFlight             2         1"));
+    ASSERT_EQ(string::npos, report.find("setFlightStatus"));
+
+    util::resetMetrics();
+    ASSERT_EQ(0u, util::getOperationStats(Operation::AddFlight).m_calls);
+}
+
+/**
+ * @brief Tests that the counters of every thread are summed, those of finished threads included.
+ */
+TEST(Metrics, ThreadsAreSummed)
+{
+    util::resetMetrics();
+    util::setMetricsEnabled(true);
+    vector<thread> threads;
+    for (int t = 0; t < 8; ++t)
+    {
+        threads.emplace_back([]
+        {
+            for (int i = 0; i < 1000; ++i)
+                util::isValidNumber(i % 2 ? "AC1636" : "AC163");
+        });
+    }
+    for (thread& worker : threads)
+        worker.join();
+    util::setMetricsEnabled(false);
+    util::OperationStats stats = util::getOperationStats(util::Operation::ValidateNumber);
+    ASSERT_EQ(8000u, stats.m_calls);
+    ASSERT_EQ(4000u, stats.m_failures);
+}
+
+namespace
+{
+    size_t countOf(const string& p_text, const string& p_pattern)
+    {
+        size_t count = 0;
+        for (size_t at = p_text.find(p_pattern); at != string::npos; at = p_text.find(p_pattern, at + 1))
+            ++count;
+        return count;
+    }
+}
+
+/**
+ * @brief Tests the trace spans: recorded only while enabled, nested and exported as trace events.
+ */
+TEST_F(TheAirport, TraceSpans)
+{
+    aerien::Arrival arrival("LH0478","LUFTHANSA","22:05","MUNICH"," Retardé ");
+    util::clearTrace();
+    f_Airport.addFlight(arrival);
+    ASSERT_EQ(0u, countOf(util::traceJson(), "\"ph\":\"X\""));
+
+    util::setTracingEnabled(true);
+    f_Airport.deleteFlight("LH0478");
+    f_Airport.addFlight(arrival);
+    f_Airport.getAirportFormatted();
+    util::setTracingEnabled(false);
+
+    string trace = util::traceJson();
+    ASSERT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    ASSERT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+    ASSERT_EQ(1u, countOf(trace, "\"name\":\"Airport::tryDeleteFlight\""));
+    ASSERT_EQ(1u, countOf(trace, "\"name\":\"Airport::tryAddFlight\""));
+    ASSERT_EQ(1u, countOf(trace, "\"name\":\"Arrival::share\""));
+    ASSERT_EQ(1u, countOf(trace, "\"name\":\"Airport::getAirportFormatted\""));
+    ASSERT_EQ(1u, countOf(trace, "\"name\":\"Airport::formatBoard\""));
+    // the publication task of the mutations may also have built a board
+    ASSERT_LE(1u, countOf(trace, "\"name\":\"Airport::publish\""));
+
+    util::clearTrace();
+    ASSERT_EQ(0u, countOf(util::traceJson(), "\"ph\":\"X\""));
+}
+
+/**
+ * @brief Tests that the compaction of the tombstones keeps the handles and the
+ * insertion order of the remaining flights.
+ */
+TEST_F(TheAirport, CompactionKeepsHandlesAndOrder)
+{
+    vector<FlightId> ids(2000);
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        ostringstream number;
+        number << "AB" << setw(4) << setfill('0') << i;
+        f_Airport.tryAddFlight(aerien::Arrival(number.str(), "LUFTHANSA", "22:05", "MUNICH", " Retardé "), &ids[i]);
+    }
+    util::clearTrace();
+    util::setTracingEnabled(true);
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        if (i % 4 != 0)
+        {
+            ASSERT_EQ(FlightResult::Ok, f_Airport.tryDeleteFlight(ids[i]));
+        }
+    }
+    // the compactions run on the Executor
+    for (int wait = 0; wait < 200 && countOf(util::traceJson(), "\"name\":\"Airport::compact\"") == 0; ++wait)
+    {
+        this_thread::sleep_for(chrono::milliseconds(5));
+    }
+    util::setTracingEnabled(false);
+    ASSERT_LT(0u, countOf(util::traceJson(), "\"name\":\"Airport::compact\""));
+    util::clearTrace();
+
+    ASSERT_EQ(ids.size() / 4, f_Airport.getFlightCount());
+    Airport::Snapshot snapshot = f_Airport.getSnapshot();
+    ASSERT_EQ(ids.size() / 4, snapshot->m_flights.size());
+    for (size_t i = 0; i < ids.size(); i += 4)
+    {
+        ASSERT_EQ(ids[i], snapshot->m_ids[i / 4]);
+        ASSERT_EQ(snapshot->m_flights[i / 4], f_Airport.getFlight(ids[i]));
+    }
+}
+
+/**
+ * @brief Tests that a thread keeps its last TRACE_BUFFER_EVENTS spans, under its name.
+ */
+TEST(Trace, RingBufferKeepsLastSpans)
+{
+    util::clearTrace();
+    util::setTracingEnabled(true);
+    thread writer([]
+    {
+        util::setTraceThreadName("writer");
+        for (size_t i = 0; i < util::TRACE_BUFFER_EVENTS + 100; ++i)
+        {
+            TRACE_SPAN("ring test");
+        }
+    });
+    writer.join();
+    util::setTracingEnabled(false);
+
+    string trace = util::traceJson();
+    ASSERT_EQ(util::TRACE_BUFFER_EVENTS, countOf(trace, "\"name\":\"ring test\""));
+    ASSERT_EQ(1u, countOf(trace, "\"args\":{\"name\":\"writer\"}"));
+    util::clearTrace();
+}
+
+/**
+ * @brief Tests the memory breakdown: flights, objects and long strings are accounted.
+ */
+TEST_F(TheAirport, MemoryUsage)
+{
+    MemoryUsage empty = f_Airport.memoryUsage();
+    ASSERT_EQ(0u, empty.m_flights);
+    ASSERT_EQ(0u, empty.m_objects);
+    ASSERT_EQ(0u, empty.m_strings);
+    ASSERT_GE(empty.m_index, Airport::SHARD_COUNT * 64);
+
+    f_Airport.addFlight(aerien::Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+    f_Airport.addFlight(aerien::Arrival("LH0478", "LUFTHANSA", "22:05", "SAINT-JEAN-SUR-RICH", " Retardé "));
+    MemoryUsage usage = f_Airport.memoryUsage();
+    ASSERT_EQ(2u, usage.m_flights);
+    ASSERT_GT(usage.m_objects, sizeof(aerien::Depart) + sizeof(aerien::Arrival));
+    // the fields are stored inline in the flights
+    ASSERT_EQ(0u, usage.m_strings);
+    ASSERT_GE(usage.m_board, 2 * sizeof(shared_ptr<const Flight>));
+    ASSERT_EQ(usage.m_objects + usage.m_strings + usage.m_slack + usage.m_index + usage.m_board, usage.total());
+    ASSERT_NE(string::npos, usage.report().find("2 flights"));
+}
+
+namespace
+{
+    /**
+     * @brief Memory resource counting the bytes it holds, on top of the heap.
+     */
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        atomic<size_t> m_bytes {0};
+        atomic<size_t> m_allocations {0};
+
+    private:
+        void* do_allocate(size_t p_bytes, size_t p_alignment) override
+        {
+            m_bytes += p_bytes;
+            ++m_allocations;
+            return std::pmr::new_delete_resource()->allocate(p_bytes, p_alignment);
+        }
+        void do_deallocate(void* p_pointer, size_t p_bytes, size_t p_alignment) override
+        {
+            m_bytes -= p_bytes;
+            std::pmr::new_delete_resource()->deallocate(p_pointer, p_bytes, p_alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& p_other) const noexcept override
+        {
+            return this == &p_other;
+        }
+    };
+}
+
+/**
+ * @brief Tests that the flights, their strings and the indexes come from the resource of the airport.
+ */
+TEST(Airport, MemoryResource)
+{
+    CountingResource resource;
+    {
+        Airport airport("YUL", &resource);
+        ASSERT_EQ(&resource, airport.getMemoryResource());
+        airport.addFlight(aerien::Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+        size_t afterFirst = resource.m_allocations;
+        airport.addFlight(aerien::Arrival("LH0478", "LUFTHANSA", "22:05", "SAINT-JEAN-SUR-RICH", " Retardé "));
+        // the arrival with its control block, its node, the buckets, slots and entries of its shard
+        ASSERT_LE(resource.m_allocations - afterFirst, 5u);
+        ASSERT_GT(resource.m_bytes, sizeof(aerien::Depart) + sizeof(aerien::Arrival));
+        ASSERT_EQ(FlightResult::Ok, airport.setFlightStatus("LH0478", " Atterri "));
+        ASSERT_NE(string::npos, airport.getAirportFormatted().find("SAINT-JEAN-SUR-RICH| Atterri |"));
+
+        Airport copy(airport);
+        ASSERT_EQ(std::pmr::get_default_resource(), copy.getMemoryResource());
+        size_t held = resource.m_bytes;
+        Airport sameResource(airport, &resource);
+        ASSERT_LT(resource.m_bytes - held, 1024u) << "the flights must be shared, not copied";
+        ASSERT_EQ(airport.getAirportFormatted(), copy.getAirportFormatted());
+        ASSERT_EQ(airport.getAirportFormatted(), sameResource.getAirportFormatted());
+    }
+    ASSERT_EQ(0u, resource.m_bytes);
+}
+
+/**
+ * @brief Tests a board held in an arena, released at once after the airport, its copy staying valid.
+ */
+TEST(ArenaResource, ReleasedAfterAirport)
+{
+    util::ArenaResource arena;
+    unique_ptr<Airport> copy;
+    {
+        Airport airport("YUL", &arena);
+        airport.addFlight(aerien::Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+        airport.addFlight(aerien::Arrival("LH0478", "LUFTHANSA", "22:05", "SAINT-JEAN-SUR-RICH", " Retardé "));
+        ASSERT_GT(arena.getAllocatedBytes(), 2 * sizeof(aerien::Depart));
+        copy = make_unique<Airport>(airport);
+    }
+    ASSERT_EQ(0u, util::retiredCount());
+    string board = copy->getAirportFormatted();
+    arena.release();
+    ASSERT_EQ(0u, arena.getAllocatedBytes());
+    ASSERT_EQ(board, copy->getAirportFormatted());
+    ASSERT_EQ(2u, copy->getFlightCount());
+}
+
+#ifdef __GLIBC__
+/**
+ * @brief Tests that the computed breakdown is close to what the allocator really holds.
+ */
+TEST(MemoryUsage, MatchesAllocator)
+{
+    size_t before = mallinfo2().uordblks;
+    {
+        Airport airport("YUL");
+        for (int i = 0; i < 10000; ++i)
+        {
+            string number = string(1, 'A' + i % 26) + string(1, 'A' + i / 26 % 26) + to_string(1000 + i / 676);
+            if (i % 2 == 0)
+                airport.addFlight(aerien::Depart(number, "AIR CANADA", "18:00", "SAINT-JEAN-SUR-RICH", "17:15", "C86"));
+            else
+                airport.addFlight(aerien::Arrival(number, "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+        }
+        // the boards built while the flights were added are retired, not yet deleted
+        airport.getSnapshot();
+        util::reclaim();
+        MemoryUsage usage = airport.memoryUsage();
+        double measured = static_cast<double>(mallinfo2().uordblks - before);
+        ASSERT_NEAR(measured, usage.total() + sizeof(Airport), measured * 0.1) << usage.report();
+    }
+}
+#endif
@@ -127,6 +127,7 @@ TEST_F(TheArrival, setStatusValide)
 TEST_F(TheArrival, InvalidSetStatus)
 {
   ASSERT_THROW(f_Arrival.setStatus ("invalide"), PreconditionException);          
+  ASSERT_EQ(" Atterri ", f_Arrival.getStatus ());
 }
 
 /**
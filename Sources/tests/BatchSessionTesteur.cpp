@@ -0,0 +1,142 @@
+/**
+ * \file   BatchSessionTesteur.cpp
+ * \brief  Test file for the BatchSession class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "BatchSession.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "ScheduleGenerator.h"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+using namespace aerien;
+using namespace std;
+
+/**
+ * \brief Mutations are silent, queries print their rows.
+ */
+TEST(BatchSession, MutateAndQuery)
+{
+  ostringstream out;
+  BatchSession session(out);
+  istringstream commands("# a comment, then a blank line\n"
+                         "\n"
+                         "add D,AC1636,AIR CANADA,18:00,ORLONDO,17:15,C86\n"
+                         "add A,LH0478,LUFTHANSA,22:05,MUNICH, Retardé ,\r\n"
+                         "status LH0478 Atterri\n"
+                         "count\n"
+                         "get LH0478\n"
+                         "find air can\n"
+                         "delete AC1636\n"
+                         "count\n");
+  Airport expected("YUL");
+  expected.addFlight(Depart("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"));
+  expected.addFlight(Arrival("LH0478", "LUFTHANSA", "22:05", "MUNICH", " Atterri "));
+  ASSERT_EQ(10u, session.run(commands));
+  ASSERT_EQ("2\n" + expected.getFlight("LH0478")->getFlightFormatted() + "\n"
+            + expected.getFlight("AC1636")->getFlightFormatted() + "\n1\n", out.str());
+  ASSERT_EQ(1u, session.getAirport().getFlightCount());
+}
+
+/**
+ * \brief render streams the formatted board.
+ */
+TEST(BatchSession, Render)
+{
+  ostringstream out;
+  BatchSession session(out);
+  session.execute("generate 5000 3");
+  out.str("");
+  session.execute("render");
+  ASSERT_EQ(session.getAirport().getAirportFormatted(), out.str());
+}
+
+/**
+ * \brief A schedule exported, then loaded into a new airport, gives the same board.
+ */
+TEST(BatchSession, ExportAndLoad)
+{
+  const string path = "BatchSessionTesteur.csv";
+  ostringstream out;
+  BatchSession session(out);
+  session.execute("generate 2000 9");
+  session.execute("export " + path);
+
+  BatchSession loaded(out, "YQB");
+  loaded.execute("add D,ZZ0001,AIR CANADA,18:00,ORLONDO,17:15,C86");
+  out.str("");
+  loaded.execute("load " + path);
+  ASSERT_EQ("2000 rows, 2000 added, 0 duplicates, 0 invalid\n", out.str());
+  ASSERT_EQ("YQB", loaded.getAirport().getCode());
+  ASSERT_EQ(2000u, loaded.getAirport().getFlightCount());
+
+  out.str("");
+  loaded.execute("import " + path);
+  ASSERT_EQ("2000 rows, 0 added, 2000 duplicates, 0 invalid\n", out.str());
+  remove(path.c_str());
+
+  ostringstream expected;
+  ScheduleGenerator(9).writeCsv(expected, 2000);
+  out.str("");
+  loaded.execute("export -");
+  ASSERT_EQ(expected.str(), out.str());
+}
+
+/**
+ * \brief The first failing command stops the batch and names its line.
+ */
+TEST(BatchSession, ErrorsNameTheLine)
+{
+  ostringstream out;
+  BatchSession session(out);
+  istringstream commands("add D,AC1636,AIR CANADA,18:00,ORLONDO,17:15,C86\n"
+                         "add D,AC1636,AIR CANADA,19:00,ORLONDO,18:15,C87\n"
+                         "count\n");
+  try
+    {
+      session.run(commands);
+      FAIL() << "the duplicate was accepted";
+    }
+  catch (BatchError& e)
+    {
+      ASSERT_STREQ("line 2: flight AC1636 already exists", e.what());
+    }
+  ASSERT_EQ("", out.str());
+  ASSERT_THROW(session.execute("fly AC1636"), BatchError);
+  ASSERT_THROW(session.execute("generate many"), BatchError);
+  ASSERT_THROW(session.execute("airport montreal"), BatchError);
+  ASSERT_THROW(session.execute("load does-not-exist.csv"), BatchError);
+  ASSERT_THROW(session.execute("status AC1636 Atterri"), BatchError);
+}
+
+/**
+ * \brief The statistics count the calls of each command.
+ */
+TEST(BatchSession, Stats)
+{
+  ostringstream out;
+  BatchSession session(out);
+  session.execute("count");
+  session.execute("count");
+  session.execute("generate 10");
+  size_t counts = 0, generates = 0, others = 0;
+  for (const CommandStats& stats : session.getStats())
+    {
+      if (string(stats.m_name) == "count")
+        counts = stats.m_calls;
+      else if (string(stats.m_name) == "generate")
+        generates = stats.m_calls;
+      else
+        others += stats.m_calls;
+    }
+  ASSERT_EQ(2u, counts);
+  ASSERT_EQ(1u, generates);
+  ASSERT_EQ(0u, others);
+  string report = session.statsReport();
+  ASSERT_NE(string::npos, report.find("count"));
+  ASSERT_NE(string::npos, report.find("10 flights"));
+}
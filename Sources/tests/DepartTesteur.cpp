@@ -39,6 +39,22 @@ TEST(depart, ValidParameters) {
     ASSERT_EQ("X47", d1.getBoardingGate ());
 }
 
+/**
+ * \brief Test of the constructor from compile-time validated literals.
+ *
+ * This test verifies that a Depart built from literals is identical to the one
+ * built from run-time checked strings.
+ */
+TEST(depart, LiteralParameters)
+{
+  using namespace util::literals;
+  Depart d("AC1636"_fn, "AIR CANADA"_name, "18:00"_hour, "ORLONDO"_name, "17:15"_hour, "C86"_gate);
+  Depart expected("AC1636","AIR CANADA","18:00","ORLONDO","17:15","C86");
+  ASSERT_EQ(expected.getFlightFormatted (), d.getFlightFormatted ());
+  ASSERT_EQ("17:15", d.getBoardingHour ());
+  ASSERT_EQ("C86", d.getBoardingGate ());
+}
+
 /**
  * \brief Test of the constructor with an invalid flight number.
  *
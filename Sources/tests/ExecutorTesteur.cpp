@@ -0,0 +1,127 @@
+/**
+ * \file   ExecutorTesteur.cpp
+ * \brief  Test file for the Executor class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "Executor.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+/**
+ * \brief Every index of a parallelFor is visited exactly once.
+ */
+TEST(Executor, ParallelForVisitsEachIndexOnce)
+{
+  Executor executor(4);
+  vector<atomic<int>> visits(100003);
+  executor.parallelFor(3, visits.size(), 1000, [&visits](size_t p_begin, size_t p_end)
+  {
+    for (size_t i = p_begin; i < p_end; ++i)
+      ++visits[i];
+  });
+  for (size_t i = 0; i < visits.size(); ++i)
+    ASSERT_EQ(i < 3 ? 0 : 1, visits[i].load()) << i;
+}
+
+/**
+ * \brief Groups forked from inside tasks are joined without deadlock, even on one worker.
+ */
+TEST(Executor, NestedForkJoin)
+{
+  Executor executor(1);
+  atomic<int> leaves(0);
+  Executor::TaskGroup outer(executor);
+  for (int i = 0; i < 8; ++i)
+    {
+      outer.fork([&executor, &leaves]
+      {
+        Executor::TaskGroup inner(executor);
+        for (int j = 0; j < 8; ++j)
+          inner.fork([&leaves] { ++leaves; });
+        inner.join();
+      });
+    }
+  outer.join();
+  ASSERT_EQ(64, leaves.load());
+}
+
+/**
+ * \brief A join runs the tasks of its own group only, never those of another group.
+ */
+TEST(Executor, JoinRunsOwnTasksOnly)
+{
+  Executor executor(1);
+  atomic<bool> started(false);
+  atomic<bool> release(false);
+  Executor::TaskGroup busy(executor);
+  busy.fork([&started, &release]
+  {
+    started = true;
+    while (!release)
+      this_thread::yield();
+  });
+  while (!started)
+    this_thread::yield();
+
+  atomic<bool> otherRan(false);
+  Executor::TaskGroup other(executor);
+  other.fork([&otherRan] { otherRan = true; });
+  thread::id ranOn;
+  Executor::TaskGroup own(executor);
+  own.fork([&ranOn] { ranOn = this_thread::get_id(); });
+  own.join();
+  ASSERT_EQ(this_thread::get_id(), ranOn);
+  ASSERT_FALSE(otherRan.load());
+
+  release = true;
+  other.join();
+  busy.join();
+  ASSERT_TRUE(otherRan.load());
+}
+
+/**
+ * \brief The exception of a forked task is rethrown by join().
+ */
+TEST(Executor, JoinRethrows)
+{
+  Executor executor(2);
+  Executor::TaskGroup group(executor);
+  atomic<int> done(0);
+  group.fork([] { throw runtime_error("task failed"); });
+  group.fork([&done] { ++done; });
+  ASSERT_THROW(group.join(), runtime_error);
+  ASSERT_EQ(1, done.load());
+}
+
+/**
+ * \brief Submitted tasks all run before the executor is destroyed; pinned workers work too.
+ */
+TEST(Executor, SubmitAndPinning)
+{
+  atomic<int> done(0);
+  {
+    Executor executor(3, true);
+    ASSERT_EQ(3u, executor.size());
+    for (int i = 0; i < 1000; ++i)
+      executor.submit([&done] { ++done; });
+  }
+  ASSERT_EQ(1000, done.load());
+}
+
+/**
+ * \brief The library executor can no longer be configured once it exists.
+ */
+TEST(Executor, ConfigureBeforeFirstUse)
+{
+  ASSERT_TRUE(Executor::configure(2, false));
+  ASSERT_EQ(2u, Executor::instance().size());
+  ASSERT_FALSE(Executor::configure(8, false));
+  ASSERT_EQ(2u, Executor::instance().size());
+}
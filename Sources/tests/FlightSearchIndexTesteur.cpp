@@ -0,0 +1,97 @@
+/**
+ * \file   FlightSearchIndexTesteur.cpp
+ * \brief  Test file for the FlightSearchIndex class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "FlightSearchIndex.h"
+#include "Airport.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "ScheduleGenerator.h"
+#include <memory>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+/**
+ * \class SmallBoard
+ * \brief Fixture of an index over three flights.
+ */
+class SmallBoard : public ::testing::Test
+{
+public:
+  SmallBoard() : index({make_shared<Depart>("AC1636", "AIR CANADA", "18:00", "ORLONDO", "17:15", "C86"),
+                        make_shared<Arrival>("LH0478", "LUFTHANSA", "22:05", "MUNICH", " Retardé "),
+                        make_shared<Depart>("AC0870", "AIR FRANCE", "19:30", "SAINT-DENIS", "18:45", "A12")})
+  {
+  }
+  FlightSearchIndex index;
+};
+
+/**
+ * \brief A number prefix finds the flights of the airline.
+ */
+TEST_F(SmallBoard, NumberPrefix)
+{
+  ASSERT_EQ(vector<size_t>({0, 2}), index.search("AC"));
+  ASSERT_EQ(vector<size_t>({0}), index.search("AC16"));
+  ASSERT_EQ(vector<size_t>({1}), index.search("LH0478"));
+  ASSERT_TRUE(index.search("AC2").empty());
+}
+
+/**
+ * \brief Any word of a company or city starts a match, and a match may span words.
+ */
+TEST_F(SmallBoard, CompanyAndCityWords)
+{
+  ASSERT_EQ(vector<size_t>({0, 2}), index.search("AIR"));
+  ASSERT_EQ(vector<size_t>({0}), index.search("CANADA"));
+  ASSERT_EQ(vector<size_t>({2}), index.search("AIR F"));
+  ASSERT_EQ(vector<size_t>({1}), index.search("MUN"));
+  ASSERT_EQ(vector<size_t>({2}), index.search("DENIS"));
+  ASSERT_TRUE(index.search("ANADA").empty());
+}
+
+/**
+ * \brief The gate of a departure is searchable.
+ */
+TEST_F(SmallBoard, Gate)
+{
+  ASSERT_EQ(vector<size_t>({0}), index.search("C86"));
+  ASSERT_EQ(vector<size_t>({2}), index.search("A1"));
+}
+
+/**
+ * \brief Queries ignore case and surrounding spaces; a blank query matches everything.
+ */
+TEST_F(SmallBoard, Normalization)
+{
+  ASSERT_EQ(vector<size_t>({1}), index.search("  lufth "));
+  ASSERT_EQ(vector<size_t>({0, 1, 2}), index.search(""));
+  ASSERT_EQ(vector<size_t>({0, 1, 2}), index.search("   "));
+  ASSERT_EQ(3u, index.size());
+}
+
+/**
+ * \brief On a generated board, search() reports exactly the flights matches() accepts.
+ */
+TEST(FlightSearchIndex, AgreesWithMatches)
+{
+  Airport airport("YUL");
+  ScheduleGenerator(3).fill(airport, 5000);
+  Airport::Snapshot board = airport.getSnapshot();
+  FlightSearchIndex index(board->m_flights);
+  for (const char* query : {"A", "ac1", "AIR", "PARIS", "B2", "LH", "SAN", "Z", "NEW Y"})
+    {
+      vector<size_t> expected;
+      for (size_t i = 0; i < board->m_flights.size(); ++i)
+        {
+          if (FlightSearchIndex::matches(*board->m_flights[i], query))
+            expected.push_back(i);
+        }
+      ASSERT_EQ(expected, index.search(query)) << query;
+    }
+}
@@ -0,0 +1,183 @@
+/**
+ * \file   ScheduleGeneratorTesteur.cpp
+ * \brief  Test file for the ScheduleGenerator class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "ScheduleGenerator.h"
+#include "Depart.h"
+#include "validationFormat.h"
+#include <cstring>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+namespace
+{
+  bool sameFlight(const ScheduledFlight& p_a, const ScheduledFlight& p_b)
+  {
+    return p_a.m_number == p_b.m_number && p_a.m_hour == p_b.m_hour && p_a.m_boarding == p_b.m_boarding
+           && p_a.m_gate == p_b.m_gate && p_a.m_company == p_b.m_company && p_a.m_city == p_b.m_city
+           && p_a.m_arrival == p_b.m_arrival && p_a.m_status == p_b.m_status;
+  }
+}
+
+/**
+ * \brief A seed always produces the same schedule, another seed a different one.
+ */
+TEST(ScheduleGenerator, SeedIsDeterministic)
+{
+  ScheduleGenerator a(42), b(42), c(43);
+  int differences = 0;
+  for (int i = 0; i < 10000; ++i)
+    {
+      ScheduledFlight flight = a.next();
+      ASSERT_TRUE(sameFlight(flight, b.next())) << i;
+      differences += !sameFlight(flight, c.next());
+    }
+  ASSERT_GT(differences, 9000);
+  ASSERT_EQ(10000u, a.getGeneratedCount());
+}
+
+/**
+ * \brief Generated flights are valid and their numbers unique, beyond the 10 000
+ * numbers of the largest company.
+ */
+TEST(ScheduleGenerator, FlightsAreValidAndUnique)
+{
+  ScheduleGenerator generator(7);
+  unordered_set<string> numbers;
+  for (int i = 0; i < 100000; ++i)
+    {
+      unique_ptr<Flight> flight = ScheduleGenerator::makeFlight(generator.next());
+      ASSERT_TRUE(numbers.emplace(flight->getNumber()).second) << flight->getNumber();
+      const Depart* depart = dynamic_cast<const Depart*>(flight.get());
+      if (depart && depart->getHour() >= "01:00")
+        {
+          ASSERT_LT(depart->getBoardingHour(), depart->getHour());
+        }
+    }
+}
+
+/**
+ * \brief Companies, hours and statuses follow their distributions.
+ */
+TEST(ScheduleGenerator, Distributions)
+{
+  ScheduleGenerator generator(1);
+  vector<int> companies(ScheduleGenerator::COMPANY_COUNT);
+  int nearBank = 0, arrivals = 0, onTime = 0;
+  const int count = 100000;
+  for (int i = 0; i < count; ++i)
+    {
+      ScheduledFlight flight = generator.next();
+      ++companies[flight.m_company];
+      ASSERT_EQ(0, flight.m_hour % 5);
+      for (int bank : {7 * 60, 9 * 60 + 30, 12 * 60 + 30, 16 * 60, 18 * 60 + 30, 21 * 60 + 30})
+        {
+          if (abs(flight.m_hour - bank) <= 60)
+            {
+              ++nearBank;
+              break;
+            }
+        }
+      if (flight.m_arrival)
+        {
+          ++arrivals;
+          onTime += flight.m_status == ArrivalStatus::OnTime;
+        }
+    }
+  ASSERT_STREQ("AIR CANADA", ScheduleGenerator::companyName(0));
+  ASSERT_NEAR(count * 300 / 1024, companies[0], count / 100);
+  ASSERT_NEAR(count / 2, arrivals, count / 50);
+  ASSERT_NEAR(arrivals * 614 / 1024, onTime, count / 50);
+  ASSERT_GT(nearBank, count * 85 / 100);
+}
+
+/**
+ * \brief Gates are handed out in turn within a half-hour slot.
+ */
+TEST(ScheduleGenerator, GatesAreReused)
+{
+  ScheduleGenerator generator(3);
+  vector<unordered_set<uint16_t>> gates(48);
+  vector<int> departures(48);
+  for (int i = 0; i < 20000; ++i)
+    {
+      ScheduledFlight flight = generator.next();
+      int slot = flight.m_hour / 30;
+      gates[slot].insert(flight.m_gate);
+      ++departures[slot];
+    }
+  for (int slot = 0; slot < 48; ++slot)
+    {
+      ASSERT_EQ(min(departures[slot], 100), static_cast<int>(gates[slot].size())) << slot;
+    }
+}
+
+/**
+ * \brief fill() adds every generated flight to the airport.
+ */
+TEST(ScheduleGenerator, FillAirport)
+{
+  Airport airport("YUL");
+  ScheduleGenerator generator(11);
+  ASSERT_EQ(70000u, generator.fill(airport, 70000));
+  ASSERT_EQ(70000u, airport.getFlightCount());
+
+  ScheduleGenerator again(11);
+  ScheduledFlight first = again.next();
+  unique_ptr<Flight> flight = ScheduleGenerator::makeFlight(first);
+  ASSERT_EQ(flight->getFlightFormatted(), airport.getFlight(string(flight->getNumber()))->getFlightFormatted());
+}
+
+/**
+ * \brief CSV rows hold the fields of the generated flights.
+ */
+TEST(ScheduleGenerator, Csv)
+{
+  ostringstream os;
+  ScheduleGenerator(5).writeCsv(os, 5000);
+  istringstream is(os.str());
+  string line;
+  getline(is, line);
+  ASSERT_EQ("type,number,company,hour,city,boarding_or_status,gate", line);
+
+  ScheduleGenerator generator(5);
+  int rows = 0;
+  while (getline(is, line))
+    {
+      ScheduledFlight flight = generator.next();
+      ASSERT_EQ(ScheduleGenerator::csvRow(flight), line + "\n");
+      unique_ptr<Flight> built = ScheduleGenerator::makeFlight(flight);
+      string prefix = string(flight.m_arrival ? "A," : "D,");
+      for (string_view field : {built->getNumberView(), built->getCompanyView(), built->getHourView(), built->getCityView()})
+        prefix.append(field).append(",");
+      ASSERT_EQ(prefix, line.substr(0, prefix.size()));
+      ++rows;
+    }
+  ASSERT_EQ(5000, rows);
+}
+
+/**
+ * \brief The binary output is a header followed by records decoding to the generated flights.
+ */
+TEST(ScheduleGenerator, Binary)
+{
+  ostringstream os;
+  ScheduleGenerator(9).writeBinary(os, 5000);
+  string bytes = os.str();
+  ASSERT_EQ(ScheduleGenerator::BINARY_HEADER_SIZE + 5000 * ScheduleGenerator::BINARY_RECORD_SIZE, bytes.size());
+  ASSERT_EQ(0, memcmp(bytes.data(), "FMSB\1\0\0\0\x88\x13\0\0\0\0\0\0", 16));
+
+  ScheduleGenerator generator(9);
+  for (size_t i = 0; i < 5000; ++i)
+    {
+      const char* record = bytes.data() + ScheduleGenerator::BINARY_HEADER_SIZE + i * ScheduleGenerator::BINARY_RECORD_SIZE;
+      ASSERT_TRUE(sameFlight(generator.next(), ScheduleGenerator::decode(record))) << i;
+    }
+}
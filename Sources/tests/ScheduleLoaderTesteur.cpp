@@ -0,0 +1,134 @@
+/**
+ * \file   ScheduleLoaderTesteur.cpp
+ * \brief  Test file for the ScheduleLoader class.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "ScheduleLoader.h"
+#include "ScheduleGenerator.h"
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+/**
+ * \brief A generated CSV schedule loads into the board fill() builds.
+ */
+TEST(ScheduleLoader, LoadsGeneratedCsv)
+{
+  ostringstream os;
+  ScheduleGenerator(7).writeCsv(os, 20000);
+  istringstream is(os.str());
+  Airport loaded("YUL");
+  LoadReport report = ScheduleLoader().loadCsv(is, loaded);
+  ASSERT_EQ(20000u, report.m_rows);
+  ASSERT_EQ(20000u, report.m_added);
+  ASSERT_EQ(0u, report.m_duplicates);
+  ASSERT_EQ(0u, report.m_invalid);
+  ASSERT_FALSE(report.m_cancelled);
+
+  Airport filled("YUL");
+  ScheduleGenerator(7).fill(filled, 20000);
+  ASSERT_EQ(filled.getAirportFormatted(), loaded.getAirportFormatted());
+}
+
+/**
+ * \brief Invalid rows and duplicate numbers are counted, the valid rows added.
+ */
+TEST(ScheduleLoader, CountsRejectedRows)
+{
+  istringstream is("type,number,company,hour,city,boarding_or_status,gate\r\n"
+                   "D,AC1636,AIR CANADA,18:00,ORLONDO,17:15,C86\r\n"
+                   "A,LH0478,LUFTHANSA,22:05,MUNICH, Retardé ,\n"
+                   "\n"
+                   "D,AC1636,AIR CANADA,19:00,ORLONDO,18:15,C87\n"
+                   "A,LH0479,LUFTHANSA,22:05,MUNICH,Retarde,\n"
+                   "D,AC1637,AIR CANADA,25:00,ORLONDO,17:15,C86\n"
+                   "D,AC1638,AIR CANADA,18:00,ORLONDO,17:15\n"
+                   "D,AC1639,AIR CANADA,18:00,ORLONDO,17:15,C86,EXTRA\n"
+                   "X,AC1640,AIR CANADA,18:00,ORLONDO,17:15,C86\n"
+                   "A,LH0480,LUFTHANSA,22:05,MUNICH,À l'heure");
+  Airport airport("YUL");
+  LoadReport report = ScheduleLoader().loadCsv(is, airport);
+  ASSERT_EQ(9u, report.m_rows);
+  ASSERT_EQ(3u, report.m_added);
+  ASSERT_EQ(1u, report.m_duplicates);
+  ASSERT_EQ(5u, report.m_invalid);
+  ASSERT_EQ(3u, airport.getFlightCount());
+  ASSERT_EQ("18:00", airport.getFlight("AC1636")->getHour());
+  ASSERT_NE(nullptr, airport.getFlight("LH0480"));
+}
+
+/**
+ * \brief The progress is reported after each batch, and cancel() stops the
+ * loading after the current batch.
+ */
+TEST(ScheduleLoader, ProgressAndCancellation)
+{
+  const size_t batch = ScheduleLoader::BATCH_ROWS;
+  ostringstream os;
+  ScheduleGenerator(3).writeCsv(os, 5 * batch);
+  string csv = os.str();
+
+  istringstream full(csv);
+  Airport airport("YUL");
+  ScheduleLoader loader;
+  vector<size_t> rows;
+  size_t bytes = 0;
+  loader.setProgress([&](size_t p_bytes, size_t p_rows)
+  {
+    bytes = p_bytes;
+    rows.push_back(p_rows);
+  });
+  loader.loadCsv(full, airport);
+  ASSERT_EQ(5 * batch, rows.back());
+  ASSERT_EQ(batch, rows.front());
+  ASSERT_EQ(csv.size(), bytes);
+
+  istringstream cancelled(csv);
+  Airport partial("YUL");
+  ScheduleLoader stopping;
+  stopping.setProgress([&](size_t, size_t p_rows)
+  {
+    if (p_rows >= 2 * batch)
+      {
+        // as the GUI does, from another thread
+        thread([&] { stopping.cancel(); }).join();
+      }
+  });
+  LoadReport report = stopping.loadCsv(cancelled, partial);
+  ASSERT_TRUE(report.m_cancelled);
+  ASSERT_TRUE(stopping.isCancelled());
+  ASSERT_EQ(2 * batch, report.m_rows);
+  ASSERT_EQ(2 * batch, partial.getFlightCount());
+}
+
+/**
+ * \brief A board written by writeCsv is the CSV it was loaded from.
+ */
+TEST(ScheduleLoader, WriteCsvRoundTrip)
+{
+  ostringstream generated;
+  ScheduleGenerator(11).writeCsv(generated, 10000);
+  istringstream is(generated.str());
+  Airport airport("YUL");
+  ScheduleLoader().loadCsv(is, airport);
+
+  ostringstream written;
+  ScheduleLoader::writeCsv(written, *airport.getSnapshot());
+  ASSERT_EQ(generated.str(), written.str());
+}
+
+/**
+ * \brief parseRow builds the flight of a valid row and rejects an invalid one.
+ */
+TEST(ScheduleLoader, ParseRow)
+{
+  unique_ptr<Flight> flight = ScheduleLoader::parseRow("D,AC1636,AIR CANADA,18:00,ORLONDO,17:15,C86");
+  ASSERT_NE(nullptr, flight);
+  ASSERT_EQ("AC1636", flight->getNumber());
+  ASSERT_EQ(nullptr, ScheduleLoader::parseRow("D,AC1636,AIR CANADA,18:00,ORLONDO,17:15"));
+}
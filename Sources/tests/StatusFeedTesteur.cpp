@@ -0,0 +1,157 @@
+/**
+ * \file   StatusFeedTesteur.cpp
+ * \brief  Test file for the StatusFeed class and its queue.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "StatusFeed.h"
+#include "Airport.h"
+#include "Arrival.h"
+#include "Depart.h"
+#include "mpscQueue.h"
+#include "validationFormat.h"
+#include <thread>
+#include <vector>
+
+using namespace aerien;
+using namespace std;
+
+/**
+ * \brief The queue returns the records in order and refuses them when full.
+ */
+TEST(MpscQueue, FifoAndCapacity)
+{
+  util::MpscQueue<int> queue(3);
+  ASSERT_EQ(4u, queue.capacity());
+  for (int i = 0; i < 4; ++i)
+    ASSERT_TRUE(queue.tryPush(i));
+  ASSERT_FALSE(queue.tryPush(4));
+
+  int value = -1;
+  for (int i = 0; i < 4; ++i)
+    {
+      ASSERT_TRUE(queue.tryPop(value));
+      ASSERT_EQ(i, value);
+    }
+  ASSERT_FALSE(queue.tryPop(value));
+  ASSERT_TRUE(queue.tryPush(5));
+  ASSERT_EQ(5u, queue.pushedCount());
+}
+
+/**
+ * \brief Every record of several producers is received once, in the order of its producer.
+ */
+TEST(MpscQueue, ConcurrentProducers)
+{
+  const int producers = 8;
+  const int records = 20000;
+  util::MpscQueue<pair<int, int>> queue(256);
+  vector<thread> threads;
+  for (int p = 0; p < producers; ++p)
+    {
+      threads.emplace_back([&queue, p]
+      {
+        for (int i = 0; i < records; ++i)
+          {
+            while (!queue.tryPush({p, i}))
+              this_thread::yield();
+          }
+      });
+    }
+  vector<int> next(producers, 0);
+  pair<int, int> record;
+  for (int received = 0; received < producers * records; )
+    {
+      if (queue.tryPop(record))
+        {
+          ASSERT_EQ(next[record.first], record.second);
+          ++next[record.first];
+          ++received;
+        }
+    }
+  for (thread& producer : threads)
+    producer.join();
+  ASSERT_FALSE(queue.tryPop(record));
+}
+
+/**
+ * \class TheStatusFeed
+ * \brief Fixture: an airport with arrivals and a departure.
+ */
+class TheStatusFeed : public ::testing::Test
+{
+public:
+  TheStatusFeed(): f_airport("YUL")
+  {
+    for (int i = 0; i < 10; ++i)
+      f_airport.addFlight(Arrival("LH" + to_string(1000 + i), "LUFTHANSA", "22:05", "MUNICH", " Retardé "));
+    f_airport.addFlight(Depart("AC1636","AIR CANADA","18:00","ORLONDO","17:15","C86"));
+  }
+  Airport f_airport;
+};
+
+/**
+ * \brief The statuses posted are applied once flush() returns; the others are skipped.
+ */
+TEST_F(TheStatusFeed, AppliesPostedStatuses)
+{
+  StatusFeed feed(f_airport);
+  ASSERT_TRUE(feed.post("LH1003", ArrivalStatus::Landed));
+  ASSERT_TRUE(feed.post("LH1004", ArrivalStatus::OnTime));
+  ASSERT_TRUE(feed.post("AC1636", ArrivalStatus::Landed));
+  ASSERT_TRUE(feed.post("ZZ9999", ArrivalStatus::Landed));
+  ASSERT_FALSE(feed.post("LH10", ArrivalStatus::Landed));
+  feed.flush();
+
+  ASSERT_EQ(2u, feed.getAppliedCount());
+  ASSERT_EQ(" Atterri ", dynamic_cast<Arrival&>(*f_airport.getFlight("LH1003")).getStatus());
+  ASSERT_EQ("À l'heure", dynamic_cast<Arrival&>(*f_airport.getFlight("LH1004")).getStatus());
+  ASSERT_EQ(" Retardé ", dynamic_cast<Arrival&>(*f_airport.getFlight("LH1005")).getStatus());
+}
+
+/**
+ * \brief With several feeds, the last status posted for each flight wins.
+ */
+TEST_F(TheStatusFeed, ConcurrentFeeds)
+{
+  {
+    StatusFeed feed(f_airport, 64, 16);
+    vector<thread> feeds;
+    for (int f = 0; f < 4; ++f)
+      {
+        feeds.emplace_back([&feed, f]
+        {
+          for (int i = 0; i < 5000; ++i)
+            {
+              ArrivalStatus status = i == 4999 ? ArrivalStatus::Landed : ArrivalStatus::OnTime;
+              while (!feed.post("LH" + to_string(1000 + f * 2 + i % 2), status))
+                this_thread::yield();
+            }
+        });
+      }
+    for (thread& producer : feeds)
+      producer.join();
+  }
+  for (int f = 0; f < 4; ++f)
+    {
+      string landed = "LH" + to_string(1000 + f * 2 + 4999 % 2);
+      ASSERT_EQ(" Atterri ", dynamic_cast<Arrival&>(*f_airport.getFlight(landed)).getStatus()) << landed;
+    }
+}
+
+/**
+ * \brief The compact statuses match the status strings.
+ */
+TEST(ArrivalStatus, TextRoundTrip)
+{
+  for (ArrivalStatus status : {ArrivalStatus::Landed, ArrivalStatus::Delayed, ArrivalStatus::OnTime})
+    {
+      ArrivalStatus parsed;
+      ASSERT_TRUE(util::isValidStatus(statusText(status)));
+      ASSERT_TRUE(parseStatus(statusText(status), parsed));
+      ASSERT_EQ(status, parsed);
+    }
+  ArrivalStatus parsed;
+  ASSERT_FALSE(parseStatus("Landed", parsed));
+}
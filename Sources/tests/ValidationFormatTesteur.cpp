@@ -0,0 +1,279 @@
+/**
+ * \file   ValidationFormatTesteur.cpp
+ * \brief  Test file for the validation functions of validationFormat.h and batchValidation.h.
+ * \author Chih Taki-eddine
+ * \date   October 18, 2026
+ */
+#include <gtest/gtest.h>
+#include "validationFormat.h"
+#include "fieldLiterals.h"
+#include "batchValidation.h"
+#include <cctype>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace util;
+using namespace std;
+
+namespace
+{
+  /**
+   * \brief Character-by-character flight number check, as validationFormat.cpp used to do it.
+   */
+  bool referenceNumber(const string& p_number)
+  {
+    if (p_number.length() != 6)
+      return false;
+    bool valid = isupper(static_cast<unsigned char>(p_number[0]))
+                 && isupper(static_cast<unsigned char>(p_number[1]));
+    for (int i = 2; i < 6; i++)
+      {
+        valid &= isdigit(static_cast<unsigned char>(p_number[i])) != 0;
+      }
+    return valid;
+  }
+
+  /**
+   * \brief Reference 24-hour check based on std::stoi.
+   */
+  bool referenceHour(const string& p_hour)
+  {
+    if (p_hour.length() != 5 || p_hour[2] != ':')
+      return false;
+    for (int i = 0; i < 5; ++i)
+      {
+        if (i != 2 && !isdigit(static_cast<unsigned char>(p_hour[i])))
+          return false;
+      }
+    int hours = stoi(p_hour.substr(0, 2));
+    int minutes = stoi(p_hour.substr(3, 2));
+    return hours >= 0 && hours < 24 && minutes >= 0 && minutes < 60;
+  }
+
+  /**
+   * \brief Reference gate check.
+   */
+  bool referenceGate(const string& p_gate)
+  {
+    if (p_gate.length() != 3)
+      return false;
+    return isupper(static_cast<unsigned char>(p_gate[0]))
+           && isdigit(static_cast<unsigned char>(p_gate[1]))
+           && isdigit(static_cast<unsigned char>(p_gate[2]))
+           && !(p_gate[1] == '0' && p_gate[2] == '0');
+  }
+
+  /**
+   * \brief Characters around every boundary the validators care about.
+   */
+  const string INTERESTING = string("@AMZ[`amz{/059:; -") + '\0' + "\x7f\x80\xc3\xff";
+}
+
+static_assert(isValidNumber("AC1636") && !isValidNumber("A21634"));
+static_assert(isValid24Format("23:59") && !isValid24Format("24:00"));
+static_assert(isValidGate("C86") && !isValidGate("C00"));
+static_assert(isValidName("AIR CANADA") && !isValidName("AIR  CANADA"));
+static_assert(isValideCode("A-B") && !isValideCode("Yu1"));
+static_assert(isValidStatus(" Atterri ") && !isValidStatus("Atterri"));
+
+/**
+ * \brief Field literals keep their text and the compile-time and run-time
+ * validators agree on it.
+ */
+TEST(ValidationFormat, FieldLiterals)
+{
+  using namespace util::literals;
+  constexpr FlightNumber number = "AC1636"_fn;
+  constexpr Gate gate = "C86"_gate;
+  ASSERT_EQ("AC1636", number.str());
+  ASSERT_EQ("C86", gate.value());
+  ASSERT_EQ("YUL", ("YUL"_code).str());
+  ASSERT_EQ("À l'heure", ("À l'heure"_status).str());
+  ASSERT_TRUE(isValidNumber(string(number.value())));
+  ASSERT_TRUE(isValidGate(string(gate.value())));
+}
+
+/**
+ * \brief Packed values returned by the parsers for valid fields.
+ */
+TEST(ValidationFormat, PackedValues)
+{
+  uint32_t number = 0;
+  ASSERT_TRUE(parseNumber("AC1636", number));
+  ASSERT_EQ((uint32_t('A') << 24) | (uint32_t('C') << 16) | 1636u, number);
+
+  uint16_t minutes = 0;
+  ASSERT_TRUE(parse24Format("23:59", minutes));
+  ASSERT_EQ(23 * 60 + 59, minutes);
+  ASSERT_TRUE(parse24Format("00:00", minutes));
+  ASSERT_EQ(0, minutes);
+
+  uint16_t gate = 0;
+  ASSERT_TRUE(parseGate("C86", gate));
+  ASSERT_EQ((uint16_t('C') << 8) | 86, gate);
+}
+
+/**
+ * \brief Invalid fields are rejected and reported with a zero packed value.
+ */
+TEST(ValidationFormat, InvalidFieldsPackToZero)
+{
+  uint32_t number = 1;
+  ASSERT_FALSE(parseNumber("A21634", number));
+  ASSERT_EQ(0u, number);
+
+  uint16_t minutes = 1;
+  ASSERT_FALSE(parse24Format("24:00", minutes));
+  ASSERT_EQ(0, minutes);
+
+  uint16_t gate = 1;
+  ASSERT_FALSE(parseGate("C00", gate));
+  ASSERT_EQ(0, gate);
+}
+
+/**
+ * \brief Every single-character change of a valid flight number, and random strings,
+ * are classified exactly like the reference implementation.
+ */
+TEST(ValidationFormat, NumberMatchesReference)
+{
+  for (size_t pos = 0; pos < 6; ++pos)
+    {
+      for (int c = 0; c < 256; ++c)
+        {
+          string number = "AC1636";
+          number[pos] = static_cast<char>(c);
+          ASSERT_EQ(referenceNumber(number), isValidNumber(number)) << number;
+        }
+    }
+  mt19937 gen(26);
+  uniform_int_distribution<size_t> pick(0, INTERESTING.size() - 1);
+  uniform_int_distribution<size_t> length(0, 8);
+  for (int i = 0; i < 200000; ++i)
+    {
+      string number(length(gen), ' ');
+      for (char& c : number)
+        c = INTERESTING[pick(gen)];
+      ASSERT_EQ(referenceNumber(number), isValidNumber(number)) << number;
+    }
+}
+
+/**
+ * \brief Every "DD:DD" combination over the interesting characters is classified
+ * exactly like the reference implementation.
+ */
+TEST(ValidationFormat, HourMatchesReference)
+{
+  const string digits = string("0123456789/:;A") + '\xb0';
+  for (char separator : string(":;0 "))
+    {
+      for (char a : digits)
+        for (char b : digits)
+          for (char c : digits)
+            for (char d : digits)
+              {
+                string hour {a, b, separator, c, d};
+                ASSERT_EQ(referenceHour(hour), isValid24Format(hour)) << hour;
+              }
+    }
+  ASSERT_FALSE(isValid24Format("1:00"));
+  ASSERT_FALSE(isValid24Format("01:000"));
+  ASSERT_FALSE(isValid24Format(""));
+}
+
+/**
+ * \brief Every three-byte gate over the interesting characters is classified
+ * exactly like the reference implementation.
+ */
+TEST(ValidationFormat, GateMatchesReference)
+{
+  for (char a : INTERESTING)
+    for (int b = 0; b < 256; ++b)
+      for (int c = 0; c < 256; ++c)
+        {
+          string gate {a, static_cast<char>(b), static_cast<char>(c)};
+          ASSERT_EQ(referenceGate(gate), isValidGate(gate)) << gate;
+        }
+  ASSERT_FALSE(isValidGate("C8"));
+  ASSERT_FALSE(isValidGate("C861"));
+}
+
+namespace
+{
+  /**
+   * \brief Builds a column of p_count records, about one in four of them corrupted.
+   */
+  string makeColumn(const vector<string>& p_valid, size_t p_count, mt19937& p_gen)
+  {
+    uniform_int_distribution<size_t> pickValid(0, p_valid.size() - 1);
+    uniform_int_distribution<size_t> pickChar(0, INTERESTING.size() - 1);
+    uniform_int_distribution<int> corrupt(0, 3);
+    string column;
+    for (size_t i = 0; i < p_count; ++i)
+      {
+        string field = p_valid[pickValid(p_gen)];
+        if (corrupt(p_gen) == 0)
+          field[p_gen() % field.size()] = INTERESTING[pickChar(p_gen)];
+        column += field;
+      }
+    return column;
+  }
+
+  /**
+   * \brief Checks a batch validator at every available level against a scalar validator.
+   */
+  template <typename Batch, typename Scalar>
+  void checkColumn(Batch p_batch, Scalar p_scalar, const vector<string>& p_valid)
+  {
+    mt19937 gen(27);
+    size_t width = p_valid[0].size();
+    for (size_t count : {0, 1, 15, 16, 31, 33, 64, 1037})
+      {
+        string column = makeColumn(p_valid, count, gen);
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse42, SimdLevel::Avx2})
+          {
+            vector<uint64_t> mask = p_batch(column.data(), count, level);
+            ASSERT_EQ((count + 63) / 64, mask.size());
+            for (size_t i = 0; i < count; ++i)
+              {
+                string field = column.substr(i * width, width);
+                bool valid = (mask[i / 64] >> (i % 64)) & 1;
+                ASSERT_EQ(p_scalar(field), valid) << field << " at level " << static_cast<int>(level);
+              }
+          }
+      }
+  }
+}
+
+/**
+ * \brief Batch flight number validation agrees with isValidNumber at every level.
+ */
+TEST(BatchValidation, NumberColumn)
+{
+  checkColumn(validateNumberColumn, isValidNumber, {"AC1636", "DL5064", "ZZ9999", "AA0000"});
+}
+
+/**
+ * \brief Batch hour validation agrees with isValid24Format at every level.
+ */
+TEST(BatchValidation, HourColumn)
+{
+  checkColumn(validateHourColumn, isValid24Format, {"00:00", "23:59", "19:45", "20:05", "09:30"});
+}
+
+/**
+ * \brief Batch gate validation agrees with isValidGate at every level.
+ */
+TEST(BatchValidation, GateColumn)
+{
+  checkColumn(validateGateColumn, isValidGate, {"C86", "A01", "Z90", "B10"});
+}
+
+/**
+ * \brief Batch code validation agrees with isValideCode at every level.
+ */
+TEST(BatchValidation, CodeColumn)
+{
+  checkColumn(validateCodeColumn, isValideCode, {"YUL", "YYZ", "CDG", "A-B"});
+}
@@ -6,9 +6,15 @@
  * \date   June 24, 2014
  */
 #include <gtest/gtest.h>
+// Sampled invariants for the checks of this file only; the library keeps its own level.
+#define CONTRACT_LEVEL 2
+#define CONTRACT_SAMPLE_RATE 4
 #include "ContratException.h"
 #include"Flight.h"
+#include "Depart.h"
+#include "fixedString.h"
 #include <memory>
+#include <type_traits>
 using namespace aerien;
 using namespace std;
 
@@ -19,6 +25,9 @@ using namespace std;
 class TestingFlight : public Flight
 {
 public:
+  using Flight::NumberText;
+  using Flight::toField;
+
    /**
      * \brief Constructor of TestingFlight.
      * \param p_number The flight number.
@@ -128,6 +137,78 @@ TEST_F(TheFlight, SetInvalidMinutes)
 {
   ASSERT_THROW(f_flight.setHour("11:70"), PreconditionException)<<"minutes must be between 0 and 60 exclusively";
 }
+
+/**
+ * \brief Each failure of a check is counted on its site.
+ */
+TEST_F(TheFlight, ViolationsAreCounted)
+{
+  auto setHourViolations = []
+  {
+    unsigned long count = 0;
+    for (const ContractSite::Report& site : ContractSite::reqSites())
+      {
+        if (site.m_kind == "PRECONDITION" && site.m_expression == "util::isValid24Format(p_hour)"
+            && site.m_file.find("Flight.cpp") != string::npos)
+          count += site.m_violations;
+      }
+    return count;
+  };
+  unsigned long before = setHourViolations();
+  ASSERT_THROW(f_flight.setHour("27:00"), PreconditionException);
+  ASSERT_THROW(f_flight.setHour("11:70"), PreconditionException);
+  ASSERT_EQ(before + 2, setHourViolations());
+}
+
+namespace
+{
+  /**
+   * \brief Counts how often its invariant is checked.
+   */
+  struct SampledInvariant
+  {
+    int m_checks = 0;
+    void touch() { INVARIANTS(); }
+    void verifieInvariant() { ++m_checks; }
+  };
+
+  /**
+   * \brief Counts how often its postcondition and assertion are evaluated.
+   */
+  struct SampledConditions
+  {
+    int m_postconditions = 0;
+    int m_assertions = 0;
+    void touch()
+    {
+      ASSERTION(++m_assertions > 0);
+      POSTCONDITION(++m_postconditions > 0);
+    }
+  };
+}
+
+/**
+ * \brief At level 2, INVARIANTS() checks one call in CONTRACT_SAMPLE_RATE, starting with the first.
+ */
+TEST(Contract, SampledInvariants)
+{
+  SampledInvariant object;
+  for (int i = 0; i < 4 * CONTRACT_SAMPLE_RATE; ++i)
+    object.touch();
+  ASSERT_EQ(4, object.m_checks);
+}
+
+/**
+ * \brief At level 2, POSTCONDITION and ASSERTION are sampled like INVARIANTS().
+ */
+TEST(Contract, SampledConditions)
+{
+  SampledConditions object;
+  for (int i = 0; i < 4 * CONTRACT_SAMPLE_RATE; ++i)
+    object.touch();
+  ASSERT_EQ(4, object.m_postconditions);
+  ASSERT_EQ(4, object.m_assertions);
+}
 //------------------
 
 
@@ -169,13 +250,53 @@ TEST_F (TheFlight, GetFormattedFlight)
   ASSERT_EQ("|RJ0271|  ROYAL JORDANIAN  |07:12|       AMMAN       |", f_flight.getFlightFormatted ());
 }
 
+/**
+ * \brief Test of a FixedString filled to its capacity, then rejected past it.
+ */
+TEST (FixedString, Capacity)
+{
+  util::FixedString<6> number("RJ0271");
+  ASSERT_EQ(6u, number.size());
+  ASSERT_EQ("RJ0271", number.view());
+  ASSERT_STREQ("RJ0271", number.c_str());
+  ASSERT_TRUE(number == util::FixedString<6>(string("RJ0271")));
+  ASSERT_FALSE(number == "RJ0272");
+  ASSERT_TRUE(util::FixedString<6>().empty());
+  ASSERT_THROW(util::FixedString<6>("RJ02710"), length_error);
+  ASSERT_TRUE(is_trivially_copyable_v<util::FixedString<19>>);
+}
 
+/**
+ * \brief Test that a long company name is held in the flight itself.
+ */
+TEST (FixedString, FieldsAreInline)
+{
+  Depart depart("AC1636", "SAINT-JEAN-SUR-RICH", "18:00", "SAINT-JEAN-SUR-RICH", "17:15", "C86");
+  const char* begin = reinterpret_cast<const char*>(&depart);
+  ASSERT_GE(depart.getCompanyView().data(), begin);
+  ASSERT_LT(depart.getCompanyView().data(), begin + sizeof(Depart));
+  ASSERT_LE(sizeof(Depart), 128u);
+}
 
+/**
+ * \brief Test that a field too long for its storage is reported as a FlightException.
+ *
+ * The flight constructors check the length of their fields this way even
+ * when their preconditions are compiled out.
+ */
+TEST (FixedString, LongFieldIsAFlightException)
+{
+  ASSERT_EQ("RJ0271", TestingFlight::toField<TestingFlight::NumberText>("RJ0271", "flight number").view());
+  ASSERT_THROW(TestingFlight::toField<TestingFlight::NumberText>("RJ02710", "flight number"), FlightException);
+}
 
-
-
-
-
-
-
-
+/**
+ * \brief Test that the getters copy the fields and the View accessors do not.
+ */
+TEST_F (TheFlight, GettersAndViews)
+{
+  const string& number = f_flight.getNumber();
+  ASSERT_EQ(number, f_flight.getNumberView());
+  ASSERT_NE(number.data(), f_flight.getNumberView().data());
+  ASSERT_EQ(f_flight.getCity(), f_flight.getCityView());
+}
@@ -0,0 +1,279 @@
+/**
+ * \file trace.cpp
+ * \brief Implementation of the trace spans and of their Chrome trace export
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * Each thread takes a TraceBuffer from a lock-free list and gives it back
+ * when it exits; a later thread reuses it, under the same trace thread id.
+ * Only the owner writes a buffer, as a sequence lock: it announces the span
+ * in m_writing, fills it, then publishes it in m_written. The exporter reads
+ * the spans below m_written, then reads m_writing and drops the spans the
+ * owner may have overwritten meanwhile.
+ */
+
+#include "trace.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace util {
+
+namespace {
+
+struct Span
+{
+  std::atomic<const char*> m_name {nullptr};
+  std::atomic<std::uint64_t> m_start {0};
+  std::atomic<std::uint64_t> m_end {0};
+};
+
+struct TraceBuffer
+{
+  Span m_spans[TRACE_BUFFER_EVENTS];
+  std::atomic<std::uint64_t> m_writing {0};
+  std::atomic<std::uint64_t> m_written {0};
+  std::atomic<bool> m_owned {true};
+  std::uint32_t m_threadId = 0;
+  TraceBuffer* m_next = nullptr;
+
+  // guarded by s_exportMutex
+  std::string m_threadName;
+  std::uint64_t m_clearedAt = 0;
+};
+
+std::atomic<TraceBuffer*> s_buffers {nullptr};
+std::atomic<std::uint32_t> s_nextThreadId {1};
+std::mutex s_exportMutex;
+
+/**
+ * \brief Takes a free buffer, or pushes a new one; buffers are never freed.
+ */
+TraceBuffer* acquireBuffer()
+{
+  for (TraceBuffer* buffer = s_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->m_next)
+    {
+      bool owned = false;
+      if (!buffer->m_owned.load(std::memory_order_relaxed)
+          && buffer->m_owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+        return buffer;
+    }
+  TraceBuffer* buffer = new TraceBuffer;
+  buffer->m_threadId = s_nextThreadId.fetch_add(1);
+  buffer->m_next = s_buffers.load(std::memory_order_relaxed);
+  while (!s_buffers.compare_exchange_weak(buffer->m_next, buffer, std::memory_order_release))
+    {
+    }
+  return buffer;
+}
+
+/**
+ * \brief Buffer of the calling thread, given back when the thread exits.
+ */
+struct BufferOwner
+{
+  TraceBuffer* m_buffer = acquireBuffer();
+
+  ~BufferOwner()
+  {
+    m_buffer->m_owned.store(false, std::memory_order_release);
+  }
+};
+
+/**
+ * \brief Name given by setTraceThreadName() before the thread recorded a span.
+ */
+thread_local std::string t_threadName;
+thread_local TraceBuffer* t_buffer = nullptr;
+
+TraceBuffer& threadBuffer()
+{
+  thread_local BufferOwner owner;
+  if (t_buffer == nullptr)
+    {
+      t_buffer = owner.m_buffer;
+      std::lock_guard<std::mutex> lock(s_exportMutex);
+      t_buffer->m_threadName = t_threadName;
+    }
+  return *t_buffer;
+}
+
+struct Copied
+{
+  const char* m_name;
+  std::uint64_t m_start;
+  std::uint64_t m_end;
+};
+
+/**
+ * \brief Copies the spans of a buffer still present in its ring.
+ */
+std::vector<Copied> copySpans(const TraceBuffer& p_buffer)
+{
+  std::uint64_t written = p_buffer.m_written.load(std::memory_order_acquire);
+  std::uint64_t first = written > TRACE_BUFFER_EVENTS ? written - TRACE_BUFFER_EVENTS : 0;
+  first = first > p_buffer.m_clearedAt ? first : p_buffer.m_clearedAt;
+  std::vector<Copied> spans;
+  for (std::uint64_t i = first; i < written; ++i)
+    {
+      const Span& span = p_buffer.m_spans[i % TRACE_BUFFER_EVENTS];
+      spans.push_back(Copied{span.m_name.load(std::memory_order_relaxed),
+                             span.m_start.load(std::memory_order_relaxed),
+                             span.m_end.load(std::memory_order_relaxed)});
+    }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  std::uint64_t writing = p_buffer.m_writing.load(std::memory_order_relaxed);
+  if (writing > first + TRACE_BUFFER_EVENTS)
+    {
+      std::size_t overwritten = static_cast<std::size_t>(writing - TRACE_BUFFER_EVENTS - first);
+      spans.erase(spans.begin(), spans.begin() + std::min(overwritten, spans.size()));
+    }
+  return spans;
+}
+
+void writeString(std::ostream& p_os, const std::string& p_text)
+{
+  p_os << '"';
+  for (char c : p_text)
+    {
+      if (c == '"' || c == '\\')
+        p_os << '\\' << c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+        p_os << ' ';
+      else
+        p_os << c;
+    }
+  p_os << '"';
+}
+
+/**
+ * \brief Writes a time in microseconds, the unit of the trace-event format.
+ */
+void writeMicroseconds(std::ostream& p_os, std::uint64_t p_nanoseconds)
+{
+  char text[32];
+  std::snprintf(text, sizeof(text), "%llu.%03llu", static_cast<unsigned long long>(p_nanoseconds / 1000),
+                static_cast<unsigned long long>(p_nanoseconds % 1000));
+  p_os << text;
+}
+
+}
+
+/**
+ * \brief Starts or stops the recording of the spans.
+ */
+void setTracingEnabled(bool p_enabled)
+{
+  s_tracingEnabled.store(p_enabled, std::memory_order_relaxed);
+}
+
+/**
+ * \brief Names the calling thread in the exported timeline.
+ *
+ * A thread that never records a span costs no buffer, named or not.
+ */
+void setTraceThreadName(const std::string& p_name)
+{
+  t_threadName = p_name;
+  if (t_buffer != nullptr)
+    {
+      std::lock_guard<std::mutex> lock(s_exportMutex);
+      t_buffer->m_threadName = p_name;
+    }
+}
+
+/**
+ * \brief Writes the recorded spans of all the threads as Chrome trace-event JSON.
+ *
+ * Each span is a complete ("X") event; the times are relative to the
+ * earliest span exported.
+ */
+void writeTrace(std::ostream& p_os)
+{
+  std::lock_guard<std::mutex> lock(s_exportMutex);
+  std::vector<std::pair<const TraceBuffer*, std::vector<Copied>>> threads;
+  std::uint64_t origin = UINT64_MAX;
+  for (TraceBuffer* buffer = s_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->m_next)
+    {
+      threads.emplace_back(buffer, copySpans(*buffer));
+      for (const Copied& span : threads.back().second)
+        origin = span.m_start < origin ? span.m_start : origin;
+    }
+
+  p_os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n"
+       << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"aerien\"}}";
+  for (const auto& thread : threads)
+    {
+      std::uint32_t tid = thread.first->m_threadId;
+      if (!thread.first->m_threadName.empty())
+        {
+          p_os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":";
+          writeString(p_os, thread.first->m_threadName);
+          p_os << "}}";
+        }
+      for (const Copied& span : thread.second)
+        {
+          p_os << ",\n{\"name\":";
+          writeString(p_os, span.m_name);
+          p_os << ",\"cat\":\"aerien\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":";
+          writeMicroseconds(p_os, span.m_start - origin);
+          p_os << ",\"dur\":";
+          writeMicroseconds(p_os, span.m_end - span.m_start);
+          p_os << '}';
+        }
+    }
+  p_os << "\n]}\n";
+}
+
+/**
+ * \brief Returns the output of writeTrace().
+ */
+std::string traceJson()
+{
+  std::ostringstream os;
+  writeTrace(os);
+  return os.str();
+}
+
+/**
+ * \brief Drops the spans recorded so far.
+ *
+ * The buffers of the threads are not written: each one remembers the number
+ * of spans to skip.
+ */
+void clearTrace()
+{
+  std::lock_guard<std::mutex> lock(s_exportMutex);
+  for (TraceBuffer* buffer = s_buffers.load(std::memory_order_acquire); buffer; buffer = buffer->m_next)
+    buffer->m_clearedAt = buffer->m_written.load(std::memory_order_acquire);
+}
+
+/**
+ * \brief Returns the steady clock, in nanoseconds; never 0.
+ */
+std::uint64_t traceClock()
+{
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()) | 1;
+}
+
+/**
+ * \brief Writes a span in the ring buffer of the calling thread.
+ */
+void recordSpan(const char* p_name, std::uint64_t p_start, std::uint64_t p_end)
+{
+  TraceBuffer& buffer = threadBuffer();
+  std::uint64_t written = buffer.m_written.load(std::memory_order_relaxed);
+  Span& span = buffer.m_spans[written % TRACE_BUFFER_EVENTS];
+  buffer.m_writing.store(written + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  span.m_name.store(p_name, std::memory_order_relaxed);
+  span.m_start.store(p_start, std::memory_order_relaxed);
+  span.m_end.store(p_end, std::memory_order_relaxed);
+  buffer.m_written.store(written + 1, std::memory_order_release);
+}
+
+}
@@ -0,0 +1,89 @@
+/**
+ * \file trace.h
+ * \brief Scoped trace spans exported as a Chrome trace-event timeline
+ * \author Chih Taki-eddine
+ * \date 2026-10-18
+ *
+ * TRACE_SPAN("Airport::tryAddFlight") records the time spent in the rest of
+ * the enclosing scope. While tracing is disabled (the default) a span costs
+ * one relaxed load. Once setTracingEnabled(true) is called, each thread
+ * writes its spans in its own ring buffer of TRACE_BUFFER_EVENTS spans,
+ * the oldest spans being overwritten; writeTrace() exports the spans of all
+ * the threads in the Chrome trace-event JSON format read by Perfetto
+ * (ui.perfetto.dev) and chrome://tracing.
+ *
+ * Compiling with FLIGHT_TRACING=0 removes the spans entirely.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#ifndef FLIGHT_TRACING
+#  define FLIGHT_TRACING 1
+#endif
+
+namespace util {
+
+const std::size_t TRACE_BUFFER_EVENTS = 16384;
+
+void setTracingEnabled(bool p_enabled);
+void setTraceThreadName(const std::string& p_name);
+void writeTrace(std::ostream& p_os);
+std::string traceJson();
+void clearTrace();
+
+std::uint64_t traceClock();
+void recordSpan(const char* p_name, std::uint64_t p_start, std::uint64_t p_end);
+
+inline std::atomic<bool> s_tracingEnabled {false};
+
+/**
+ * \brief Returns true if the spans are being recorded.
+ */
+inline bool tracingEnabled()
+{
+  return FLIGHT_TRACING && s_tracingEnabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * \class TraceSpan
+ * \brief Records the time between its construction and its destruction.
+ *
+ * The name is kept as a pointer: it must be a string literal.
+ */
+class TraceSpan
+{
+public:
+  explicit TraceSpan(const char* p_name): m_name(p_name), m_start(0)
+  {
+    if (tracingEnabled()) [[unlikely]]
+      m_start = traceClock();
+  }
+
+  ~TraceSpan()
+  {
+    if (m_start != 0) [[unlikely]]
+      recordSpan(m_name, m_start, traceClock());
+  }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+  const char* m_name;
+  std::uint64_t m_start;
+};
+
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SPAN(p_name) util::TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(p_name)
+
+
+#endif /* TRACE_H */
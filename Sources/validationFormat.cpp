@@ -5,120 +5,56 @@
  * \date   July 6, 2024
  */
 #include "validationFormat.h"
+#include <cstring>
 namespace util {
     using namespace std;
-    /**
-     * \brief Checks if a flight number is valid.
-     *
-     * A valid flight number must have exactly 6 characters:
-     * - The first two characters must be uppercase letters.
-     * - The next four characters must be digits.
-     *
-     * \param[in] p_VolNumber The flight number to be validated.
-     * \return true if the flight number is valid, false otherwise.
-     */
-    bool isValidNumber(const std::string& p_VolNumber)
-    {
-      bool valideNumber = (p_VolNumber.length()==6); 
-      valideNumber &= isupper(p_VolNumber[0]) && isupper(p_VolNumber[1]) ;
-      for (int i = 2; i <6; i++)
-        {
-            valideNumber&=isdigit(p_VolNumber[i]) ;
-        }
-      return valideNumber;
-    }
 
-    /**
-     * \brief Checks if a time string is valid in 24-hour format.
-     *
-     * A valid time string must be in the format "HH:MM", where:
-     * - HH is between 00 and 23 (inclusive).
-     * - MM is between 00 and 59 (inclusive).
-     *
-     * \param[in] p_hour The time string to be validated.
-     * \return true if the time string is valid, false otherwise.
-     */
-    bool isValid24Format(const std::string& p_hour)
+    namespace
     {
+      // One bit per byte lane, used to collect the per-lane range failures.
+      const uint64_t HIGH_BITS = 0x8080808080808080ULL;
 
-    if (p_hour.length() != 5)
-        return false;
-
-    if (p_hour[2] != ':')
-        return false;
-
-    for (int i = 0; i < 5; ++i)
-    {
-        if (i == 2)
-            continue; 
-
-        if (!isdigit(p_hour[i]))
-            return false;
-    }
-
-    int hours = std::stoi(p_hour.substr(0, 2));
-    int minutes = std::stoi(p_hour.substr(3, 2));
-
-    if (hours < 0 || hours >= 24 || minutes < 0 || minutes >= 60)
-        return false;
+      /**
+       * \brief Loads a short field into the low bytes of a 64-bit word.
+       *
+       * Byte i of the field ends up in bits [8i, 8i+8) whatever the host byte order,
+       * unused lanes are zero.
+       */
+      template <size_t LENGTH>
+      inline uint64_t loadField(const char* p_field)
+      {
+        uint64_t word = 0;
+        memcpy(&word, p_field, LENGTH);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+      }
 
-    return true;
-    }
-
-    /**
-     * \brief Checks if a gate string is valid.
-     *
-     * A valid gate string must have exactly 3 characters:
-     * - The first character must be an uppercase letter.
-     * - The second and third characters must be digits.
-     * - The gate number cannot be "00".
-     *
-     * \param[in] p_gate The gate string to be validated.
-     * \return true if the gate string is valid, false otherwise.
-     */
-    bool isValidGate(const std::string& p_gate)
-    {
-      bool valideGate = (p_gate.length()==3); 
-      valideGate&= isupper(p_gate[0]) && true ;
-      valideGate&=isdigit(p_gate[1]) ;
-      valideGate&=isdigit(p_gate[2]) ;
-      valideGate&=!(p_gate[1]=='0'&&p_gate[2]=='0');
-      return valideGate;
-    }
-    
-    /**
-     * \brief Checks if a name string is valid.
-     *
-     * A valid name must be between 3 and 19 characters long, start with an uppercase letter,
-     * and only contain uppercase letters, hyphens, and spaces. Hyphens and spaces must
-     * be followed by an uppercase letter and not appear consecutively or at the end.
-     *
-     * \param[in] p_name The name string to be validated.
-     * \return true if the name string is valid, false otherwise.
-     */
-    bool isValidName (const string& p_name)
-    {
-      int longNom= p_name.length();
-      if(longNom<3 || longNom>19 || !isupper(p_name[0]))
-        return false;
+      /**
+       * \brief Checks every byte lane of a word against its own [low, high] range.
+       *
+       * p_low holds the lower bound of each lane and p_highAdd holds 0x7F minus its
+       * upper bound; unused lanes carry 0 in the word and in both constants.
+       * A borrow or carry can only leak out of a lane that is already out of range,
+       * so the result is exact for the lanes that matter.
+       *
+       * \return 0 if every lane is in range, a non-zero value otherwise.
+       */
+      inline uint64_t outOfRange(uint64_t p_word, uint64_t p_low, uint64_t p_highAdd)
+      {
+        return ((p_word - p_low) | (p_word + p_highAdd) | p_word) & HIGH_BITS;
+      }
 
-      for (int i = 1; i < p_name.length (); i++)
-        {
-          if (!isalpha (p_name[i]))
-            {
-              if (p_name[i] == '-' || p_name[i] == ' ' )
-                {
-                  if (i == p_name.length () - 1 || p_name[i + 1] == '-' ||  p_name[i + 1] == ' ' || !isupper(p_name[i+1]))
-                    return false;
-                  i++;
-                }
-              else
-                return false;
-            }
-          else if(!isupper(p_name[i]))
-            return false;
-        }
-      return true;
+      /**
+       * \brief Combines adjacent digit lanes: lane i becomes 10 * lane i + lane i+1.
+       *
+       * The lanes must already hold values 0 to 9.
+       */
+      inline uint64_t pairDigits(uint64_t p_digits)
+      {
+        return p_digits * 10 + (p_digits >> 8);
+      }
     }
 
     /**
@@ -131,9 +67,9 @@ namespace util {
      * \param[in] p_width The desired width of the string.
      * \return The adjusted string.
      */
-    string  adjustWidth(const string& p_field, int p_width)
+    string  adjustWidth(string_view p_field, int p_width)
     {
-      string adjustField = p_field;
+      string adjustField(p_field);
       bool ajoutEspaceAGauche=false;
         while (adjustField.size()<(u_int)p_width)
           {
@@ -148,39 +84,123 @@ namespace util {
     }
 
     /**
-     * \brief Checks if a code string is valid.
+     * \brief Validates and parses a flight number with a single word load.
      *
-     * A valid code string must be exactly 3 characters long and consist of uppercase letters only.
+     * Accepts exactly the same inputs as isValidNumber(): two uppercase letters
+     * followed by four digits.
      *
-     * \param[in] p_code The code string to be validated.
-     * \return true if the code string is valid, false otherwise.
+     * \param[in] p_field Pointer to the first character of the field.
+     * \param[in] p_length Number of characters in the field.
+     * \param[out] p_packed The two letters in bits 31-24 and 23-16 and the
+     *             numeric part (0 to 9999) in bits 15-0, or 0 if the field is invalid.
+     * \return true if the flight number is valid, false otherwise.
      */
-    bool isValideCode(const std::string & p_code){
-      if (p_code.size() != 3 )
-        return false;
-      for (int i=0; i < p_code.size(); i++){
-         if (islower(p_code[i]) || isdigit(p_code[i]))
-            {
-              return false;
-            }
+    bool parseNumber(const char* p_field, size_t p_length, uint32_t& p_packed)
+    {
+      if (p_length != 6)
+        {
+          p_packed = 0;
+          return false;
         }
-      return true;
+      // lanes: 'A'-'Z', 'A'-'Z', then four '0'-'9'
+      uint64_t word = loadField<6>(p_field);
+      bool valid = outOfRange(word, 0x0000303030304141ULL, 0x0000464646462525ULL) == 0;
+
+      uint32_t digits = static_cast<uint32_t>(word >> 16) & 0x0F0F0F0F;
+      digits = static_cast<uint32_t>(pairDigits(digits)) & 0x00FF00FF;
+      digits = (digits * 100 + (digits >> 16)) & 0xFFFF;
+
+      uint32_t packed = (static_cast<uint32_t>(word & 0xFF) << 24)
+                      | (static_cast<uint32_t>((word >> 8) & 0xFF) << 16) | digits;
+      p_packed = valid ? packed : 0;
+      return valid;
+    }
+
+    /**
+     * \brief Validates and parses a flight number.
+     * \see parseNumber(const char*, size_t, uint32_t&)
+     */
+    bool parseNumber(std::string_view p_number, uint32_t& p_packed)
+    {
+      return parseNumber(p_number.data(), p_number.size(), p_packed);
     }
 
     /**
-     * \brief Checks if a status string is valid.
+     * \brief Validates and parses a 24-hour "HH:MM" time with a single word load.
      *
-     * A valid status string must be one of the following:
-     * - " Atterri "
-     * - " Retardé "
-     * - "À l'heure"
+     * Accepts exactly the same inputs as isValid24Format().
      *
-     * \param[in] p_status The status string to be validated.
-     * \return true if the status string is valid, false otherwise.
-     */    
-    bool isValidStatus(const std::string& p_status){
-        { 
-          return (p_status == " Atterri " || p_status == " Retardé " || p_status == "À l'heure");
+     * \param[in] p_field Pointer to the first character of the field.
+     * \param[in] p_length Number of characters in the field.
+     * \param[out] p_minutes The number of minutes since midnight (0 to 1439),
+     *             or 0 if the field is invalid.
+     * \return true if the time is valid, false otherwise.
+     */
+    bool parse24Format(const char* p_field, size_t p_length, uint16_t& p_minutes)
+    {
+      if (p_length != 5)
+        {
+          p_minutes = 0;
+          return false;
         }
+      // lanes: '0'-'2', '0'-'9', ':', '0'-'5', '0'-'9'
+      uint64_t word = loadField<5>(p_field);
+      bool valid = outOfRange(word, 0x00000030303A3030ULL, 0x000000464A45464DULL) == 0;
+
+      uint64_t pairs = pairDigits((word - 0x0000003030003030ULL) & 0x0000000F0F000F0FULL);
+      uint32_t hours = static_cast<uint32_t>(pairs & 0xFF);
+      uint32_t minutes = static_cast<uint32_t>((pairs >> 24) & 0xFF);
+      valid &= hours < 24;
+
+      p_minutes = valid ? static_cast<uint16_t>(hours * 60 + minutes) : 0;
+      return valid;
+    }
+
+    /**
+     * \brief Validates and parses a 24-hour time.
+     * \see parse24Format(const char*, size_t, uint16_t&)
+     */
+    bool parse24Format(std::string_view p_hour, uint16_t& p_minutes)
+    {
+      return parse24Format(p_hour.data(), p_hour.size(), p_minutes);
+    }
+
+    /**
+     * \brief Validates and parses a boarding gate with a single word load.
+     *
+     * Accepts exactly the same inputs as isValidGate(): an uppercase letter
+     * followed by two digits other than "00".
+     *
+     * \param[in] p_field Pointer to the first character of the field.
+     * \param[in] p_length Number of characters in the field.
+     * \param[out] p_packed The letter in bits 15-8 and the gate number (1 to 99)
+     *             in bits 7-0, or 0 if the field is invalid.
+     * \return true if the gate is valid, false otherwise.
+     */
+    bool parseGate(const char* p_field, size_t p_length, uint16_t& p_packed)
+    {
+      if (p_length != 3)
+        {
+          p_packed = 0;
+          return false;
+        }
+      // lanes: 'A'-'Z', '0'-'9', '0'-'9'
+      uint64_t word = loadField<3>(p_field);
+      bool valid = outOfRange(word, 0x0000000000303041ULL, 0x0000000000464625ULL) == 0;
+
+      uint32_t number = static_cast<uint32_t>((pairDigits((word >> 8) & 0x0F0F)) & 0xFF);
+      valid &= number != 0;
+
+      p_packed = valid ? static_cast<uint16_t>(((word & 0xFF) << 8) | number) : 0;
+      return valid;
+    }
+
+    /**
+     * \brief Validates and parses a boarding gate.
+     * \see parseGate(const char*, size_t, uint16_t&)
+     */
+    bool parseGate(std::string_view p_gate, uint16_t& p_packed)
+    {
+      return parseGate(p_gate.data(), p_gate.size(), p_packed);
     }
-}
\ No newline at end of file
+}
@@ -3,20 +3,207 @@
  * \brief déclarations des fonctions de validation TP1 Aerien
  * \author Chih Taki-eddine
  * \date 2024-07-06
+ *
+ * The validators are constexpr: in a constant expression they walk the field
+ * with the CHARACTER_CLASSES table, at run time the fixed-width ones use the
+ * single-load parsers of validationFormat.cpp. Their run-time calls are
+ * recorded by the metrics of metrics.h when they are enabled.
  */
 
 #ifndef VALIDATIONFORMAT_H
 #define VALIDATIONFORMAT_H
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
+#include "characterClass.h"
+#include "metrics.h"
 namespace util {
-bool isValidNumber(const std::string& p_VolNumber);
-bool isValid24Format(const std::string& p_Hour);
-bool isValidGate(const std::string& p_gate);
-bool isValidName(const std::string& p_name);
-bool isValideCode(const std::string & p_code);
-std::string  adjustWidth(const std::string& p_field, int p_width=19);
-bool isValidStatus(const std::string& p_status);
+const std::size_t NUMBER_LENGTH = 6;     ///< Two letters and four digits.
+const std::size_t HOUR_LENGTH = 5;       ///< "HH:MM".
+const std::size_t GATE_LENGTH = 3;       ///< A letter and two digits.
+const std::size_t CODE_LENGTH = 3;       ///< Airport code.
+const std::size_t NAME_MAX_LENGTH = 19;  ///< Longest company or city name.
 
+std::string  adjustWidth(std::string_view p_field, int p_width=19);
+
+bool parseNumber(const char* p_field, std::size_t p_length, std::uint32_t& p_packed);
+bool parseNumber(std::string_view p_number, std::uint32_t& p_packed);
+bool parse24Format(const char* p_field, std::size_t p_length, std::uint16_t& p_minutes);
+bool parse24Format(std::string_view p_hour, std::uint16_t& p_minutes);
+bool parseGate(const char* p_field, std::size_t p_length, std::uint16_t& p_packed);
+bool parseGate(std::string_view p_gate, std::uint16_t& p_packed);
+
+/**
+ * \brief Checks if a flight number is valid.
+ *
+ * A valid flight number must have exactly 6 characters:
+ * - The first two characters must be uppercase letters.
+ * - The next four characters must be digits.
+ *
+ * \param[in] p_VolNumber The flight number to be validated.
+ * \return true if the flight number is valid, false otherwise.
+ */
+constexpr bool isValidNumber(std::string_view p_VolNumber)
+{
+  if (!std::is_constant_evaluated())
+    {
+      OperationTimer timer(Operation::ValidateNumber);
+      std::uint32_t packed;
+      return timer.result(parseNumber(p_VolNumber.data(), p_VolNumber.size(), packed));
+    }
+  if (p_VolNumber.size() != 6 || !isUpper(p_VolNumber[0]) || !isUpper(p_VolNumber[1]))
+    return false;
+  for (std::size_t i = 2; i < 6; i++)
+    {
+      if (!isDigit(p_VolNumber[i]))
+        return false;
+    }
+  return true;
+}
+
+/**
+ * \brief Checks if a time string is valid in 24-hour format.
+ *
+ * A valid time string must be in the format "HH:MM", where:
+ * - HH is between 00 and 23 (inclusive).
+ * - MM is between 00 and 59 (inclusive).
+ *
+ * \param[in] p_hour The time string to be validated.
+ * \return true if the time string is valid, false otherwise.
+ */
+constexpr bool isValid24Format(std::string_view p_hour)
+{
+  if (!std::is_constant_evaluated())
+    {
+      OperationTimer timer(Operation::Validate24Format);
+      std::uint16_t minutes;
+      return timer.result(parse24Format(p_hour.data(), p_hour.size(), minutes));
+    }
+  if (p_hour.size() != 5 || p_hour[2] != ':' || !isDigit(p_hour[0]) || !isDigit(p_hour[1])
+      || !isDigit(p_hour[3]) || !isDigit(p_hour[4]))
+    return false;
+  int hours = (p_hour[0] - '0') * 10 + (p_hour[1] - '0');
+  int minutes = (p_hour[3] - '0') * 10 + (p_hour[4] - '0');
+  return hours < 24 && minutes < 60;
+}
+
+/**
+ * \brief Checks if a gate string is valid.
+ *
+ * A valid gate string must have exactly 3 characters:
+ * - The first character must be an uppercase letter.
+ * - The second and third characters must be digits.
+ * - The gate number cannot be "00".
+ *
+ * \param[in] p_gate The gate string to be validated.
+ * \return true if the gate string is valid, false otherwise.
+ */
+constexpr bool isValidGate(std::string_view p_gate)
+{
+  if (!std::is_constant_evaluated())
+    {
+      OperationTimer timer(Operation::ValidateGate);
+      std::uint16_t packed;
+      return timer.result(parseGate(p_gate.data(), p_gate.size(), packed));
+    }
+  return p_gate.size() == 3 && isUpper(p_gate[0]) && isDigit(p_gate[1]) && isDigit(p_gate[2])
+         && !(p_gate[1] == '0' && p_gate[2] == '0');
+}
+
+/**
+ * \brief The check of isValidName, without the metrics.
+ */
+constexpr bool hasNameFormat(std::string_view p_name)
+{
+  std::size_t longNom = p_name.size();
+  if (longNom < 3 || longNom > NAME_MAX_LENGTH || !isUpper(p_name[0]))
+    return false;
+
+  for (std::size_t i = 1; i < longNom; i++)
+    {
+      unsigned char current = characterClass(p_name[i]);
+      if (current & CLASS_UPPER)
+        continue;
+      // a separator must be followed by an uppercase letter, which is then skipped
+      if (!(current & CLASS_SEPARATOR) || i == longNom - 1 || !isUpper(p_name[i + 1]))
+        return false;
+      i++;
+    }
+  return true;
+}
+
+/**
+ * \brief Checks if a name string is valid.
+ *
+ * A valid name must be between 3 and 19 characters long, start with an uppercase letter,
+ * and only contain uppercase letters, hyphens, and spaces. Hyphens and spaces must
+ * be followed by an uppercase letter and not appear consecutively or at the end.
+ *
+ * \param[in] p_name The name string to be validated.
+ * \return true if the name string is valid, false otherwise.
+ */
+constexpr bool isValidName(std::string_view p_name)
+{
+  OperationTimer timer(Operation::ValidateName);
+  return timer.result(hasNameFormat(p_name));
+}
+
+/**
+ * \brief The check of isValideCode, without the metrics.
+ */
+constexpr bool hasCodeFormat(std::string_view p_code)
+{
+  if (p_code.size() != CODE_LENGTH)
+    return false;
+  for (char c : p_code)
+    {
+      if (characterClass(c) & (CLASS_LOWER | CLASS_DIGIT))
+        return false;
+    }
+  return true;
+}
+
+/**
+ * \brief Checks if a code string is valid.
+ *
+ * A valid code string must be exactly 3 characters long and contain
+ * neither lowercase letters nor digits.
+ *
+ * \param[in] p_code The code string to be validated.
+ * \return true if the code string is valid, false otherwise.
+ */
+constexpr bool isValideCode(std::string_view p_code)
+{
+  OperationTimer timer(Operation::ValidateCode);
+  return timer.result(hasCodeFormat(p_code));
+}
+
+/**
+ * \brief The check of isValidStatus, without the metrics.
+ */
+constexpr bool isStatusText(std::string_view p_status)
+{
+  return p_status == " Atterri " || p_status == " Retardé " || p_status == "À l'heure";
+}
+
+/**
+ * \brief Checks if a status string is valid.
+ *
+ * A valid status string must be one of the following:
+ * - " Atterri "
+ * - " Retardé "
+ * - "À l'heure"
+ *
+ * \param[in] p_status The status string to be validated.
+ * \return true if the status string is valid, false otherwise.
+ */
+constexpr bool isValidStatus(std::string_view p_status)
+{
+  OperationTimer timer(Operation::ValidateStatus);
+  return timer.result(isStatusText(p_status));
+}
 
 }
 